@@ -44,15 +44,27 @@ endif()
 set(re-common_BUILD_HEADERS
     ${RE_COMMON_CPP_SRC_DIR}/AudioBuffer.h
     ${RE_COMMON_CPP_SRC_DIR}/AudioSocket.h
+    ${RE_COMMON_CPP_SRC_DIR}/Biquad.h
     ${RE_COMMON_CPP_SRC_DIR}/CVSocket.h
     ${RE_COMMON_CPP_SRC_DIR}/fmt.h
     ${RE_COMMON_CPP_SRC_DIR}/jbox.h
     ${RE_COMMON_CPP_SRC_DIR}/CircularBuffer.h
     ${RE_COMMON_CPP_SRC_DIR}/CommonDevice.h
     ${RE_COMMON_CPP_SRC_DIR}/Constants.h
+    ${RE_COMMON_CPP_SRC_DIR}/DelayLine.h
+    ${RE_COMMON_CPP_SRC_DIR}/Denormals.h
+    ${RE_COMMON_CPP_SRC_DIR}/DSPKernels.h
+    ${RE_COMMON_CPP_SRC_DIR}/Dynamics.h
     ${RE_COMMON_CPP_SRC_DIR}/JBoxProperty.h
     ${RE_COMMON_CPP_SRC_DIR}/JBoxPropertyManager.h
     ${RE_COMMON_CPP_SRC_DIR}/JukeboxExports.h
+    ${RE_COMMON_CPP_SRC_DIR}/Meter.h
+    ${RE_COMMON_CPP_SRC_DIR}/MixBus.h
+    ${RE_COMMON_CPP_SRC_DIR}/Oversampler.h
+    ${RE_COMMON_CPP_SRC_DIR}/Pan.h
+    ${RE_COMMON_CPP_SRC_DIR}/SlidingWindow.h
+    ${RE_COMMON_CPP_SRC_DIR}/SPSCRingBuffer.h
+    ${RE_COMMON_CPP_SRC_DIR}/Smoother.h
     ${RE_COMMON_CPP_SRC_DIR}/Utils.h
     ${RE_COMMON_CPP_SRC_DIR}/SampleRateBasedClock.h
     ${RE_COMMON_CPP_SRC_DIR}/StaticString.h
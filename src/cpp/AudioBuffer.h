@@ -8,9 +8,162 @@
 
 #include "JukeboxTypes.h"
 #include "Constants.h"
+#include "DSPKernels.h"
 #include "Jukebox.h"
+#include "Pan.h"
 #include "Volume.h"
 #include "XFade.h"
+#include <cstddef>
+
+/**
+ * Alignment of the samples in `TAudioBuffer` (a cache line, which is also enough for any vector instruction set) */
+constexpr int kAudioBufferAlignment = 64;
+
+/**
+ * Result of `TAudioBuffer::analyze` / `TStereoAudioBuffer::analyze`: everything that metering and silence gating need,
+ * computed in a single pass over the samples. */
+struct AudioBufferStats
+{
+  TJBox_AudioSample fPeak{0};
+  TJBox_Float32 fSum{0};
+  TJBox_Float32 fSumOfSquares{0};
+  int fCount{0};
+
+  /**
+   * Same definition as `TAudioBuffer::isSilent`: everything below `kJBox_SilentThreshold` is silent */
+  inline bool isSilent() const { return fPeak <= kJBox_SilentThreshold; }
+
+  inline TJBox_Float32 rms() const { return fCount > 0 ? std::sqrt(fSumOfSquares / fCount) : 0; }
+
+  inline TJBox_Float32 dcOffset() const { return fCount > 0 ? fSum / fCount : 0; }
+
+  inline void merge(AudioBufferStats const &rhs)
+  {
+    fPeak = std::max(fPeak, rhs.fPeak);
+    fSum += rhs.fSum;
+    fSumOfSquares += rhs.fSumOfSquares;
+    fCount += rhs.fCount;
+  }
+};
+
+/**
+ * Non owning view over `fCount` contiguous samples, usually a region of a `TAudioBuffer` (see `TAudioBuffer::span`).
+ * It offers the same operations as `TAudioBuffer` restricted to the region, which allows to split a batch (ex: at the
+ * `fAtFrameIndex` of a property diff) for sample accurate changes without copying into temporary buffers:
+ *
+ * ```
+ * buffer.span(0, frameIndex).adjustGain(previousGain);
+ * buffer.span(frameIndex, kBatchSize - frameIndex).adjustGain(previousGain, newGain);
+ * ```
+ *
+ * `T` is either `TJBox_AudioSample` (`AudioSpan`) or `TJBox_AudioSample const` (`ConstAudioSpan`, read only). The
+ * span is only valid as long as the underlying buffer is.
+ */
+template <typename T>
+class TAudioSpan
+{
+public:
+  typedef TAudioSpan<T> class_type;
+  typedef TAudioSpan<TJBox_AudioSample const> const_span_type;
+
+public:
+  constexpr TAudioSpan(T *iData, int iCount) : fData{iData}, fCount{iCount} {}
+
+  // AudioSpan -> ConstAudioSpan
+  template<typename U, typename = std::enable_if_t<std::is_convertible_v<U *, T *>>>
+  constexpr TAudioSpan(TAudioSpan<U> const &iOther) : fData{iOther.data()}, fCount{iOther.getSize()} {}
+
+  constexpr int getSize() const { return fCount; }
+
+  constexpr T *data() const { return fData; }
+
+  constexpr T &operator[](int iIndex) const { return fData[iIndex]; }
+
+  /**
+   * @return the region `[iOffset, iOffset + iCount)` of this span */
+  inline class_type subSpan(int iOffset, int iCount) const
+  {
+    JBOX_ASSERT(iOffset >= 0 && iCount >= 0 && iOffset + iCount <= fCount);
+    return class_type{fData + iOffset, iCount};
+  }
+
+  inline void accumulate(const_span_type rhs) const
+  {
+    JBOX_ASSERT(rhs.getSize() == fCount);
+    dsp::accumulate(fData, rhs.data(), fCount);
+  }
+
+  inline void copy(const_span_type rhs) const
+  {
+    JBOX_ASSERT(rhs.getSize() == fCount);
+    dsp::copy(fData, rhs.data(), fCount);
+  }
+
+  inline void adjustGain(TJBox_Float32 iGain) const
+  {
+    // no need to multiply by 1.0!
+    if(iGain == Volume_Init_Value)
+      return;
+
+    dsp::adjustGain(fData, iGain, fCount);
+  }
+
+  /**
+   * Same as `TAudioBuffer::adjustGain(iFromGain, iToGain)`: `iToGain` is reached right after the end of the span */
+  inline void adjustGain(TJBox_Float32 iFromGain, TJBox_Float32 iToGain) const
+  {
+    // no need to multiply by 1.0!
+    if(iFromGain == iToGain && iFromGain == Volume_Init_Value)
+      return;
+
+    dsp::rampGain(fData, iFromGain, iToGain, fCount);
+  }
+
+  inline void clear() const
+  {
+    dsp::clear(fData, fCount);
+  }
+
+  inline void flushDenormals() const
+  {
+    dsp::flushDenormals(fData, fCount);
+  }
+
+  inline TJBox_AudioSample max() const
+  {
+    return dsp::max(fData, fCount);
+  }
+
+  inline bool isSilent() const
+  {
+    return max() <= kJBox_SilentThreshold;
+  }
+
+  inline AudioBufferStats analyze() const
+  {
+    AudioBufferStats res{};
+    res.fCount = fCount;
+    dsp::analyze(fData, fCount, res.fPeak, res.fSum, res.fSumOfSquares);
+    return res;
+  }
+
+  /**
+   * Cross fades `iSrc1` and `iSrc2` into this span. `iXFade` / `iReverseXFade` point to the curve values for the first
+   * sample of the span (ex: `xf.fXFadeFunction + offset`) */
+  inline void xFade(const_span_type iSrc1, const_span_type iSrc2,
+                    TJBox_Float32 const *iXFade, TJBox_Float32 const *iReverseXFade) const
+  {
+    JBOX_ASSERT(iSrc1.getSize() == fCount && iSrc2.getSize() == fCount);
+    dsp::xFade(fData, iSrc1.data(), iSrc2.data(), iXFade, iReverseXFade, fCount);
+  }
+
+private:
+  T *fData;
+  int fCount;
+};
+
+typedef TAudioSpan<TJBox_AudioSample> AudioSpan;
+typedef TAudioSpan<TJBox_AudioSample const> ConstAudioSpan;
 
 template <int size = kBatchSize>
 class TAudioBuffer
@@ -33,26 +186,43 @@ public:
     JBox_SetDSPBufferData(audioValue, 0, size, fAudioBuffer);
   }
 
+  /**
+   * @return a (non owning) view over the samples `[iOffset, iOffset + iCount)` */
+  inline AudioSpan span(int iOffset = 0, int iCount = size)
+  {
+    JBOX_ASSERT(iOffset >= 0 && iCount >= 0 && iOffset + iCount <= size);
+    return AudioSpan{fAudioBuffer + iOffset, iCount};
+  }
+
+  /**
+   * @return a (non owning, read only) view over the samples `[iOffset, iOffset + iCount)` */
+  inline ConstAudioSpan span(int iOffset = 0, int iCount = size) const
+  {
+    JBOX_ASSERT(iOffset >= 0 && iCount >= 0 && iOffset + iCount <= size);
+    return ConstAudioSpan{fAudioBuffer + iOffset, iCount};
+  }
+
   void accumulate(class_type const &rhs)
   {
-    TJBox_AudioSample *lhsSample = fAudioBuffer;
-    TJBox_AudioSample const *rhsSample = rhs.fAudioBuffer;
+    dsp::accumulate(fAudioBuffer, rhs.fAudioBuffer, size);
+  }
 
-    for(int i = 0; i < size; ++i, lhsSample++, rhsSample++)
-    {
-      *lhsSample = *lhsSample + *rhsSample;
-    }
+  /**
+   * Sub block version: only the samples `[iOffset, iOffset + iCount)` are processed (same for all the methods taking
+   * `iOffset` and `iCount`) */
+  void accumulate(class_type const &rhs, int iOffset, int iCount)
+  {
+    span(iOffset, iCount).accumulate(rhs.span(iOffset, iCount));
   }
 
   void copy(class_type const &rhs)
   {
-    TJBox_AudioSample *lhsSample = fAudioBuffer;
-    TJBox_AudioSample const *rhsSample = rhs.fAudioBuffer;
+    dsp::copy(fAudioBuffer, rhs.fAudioBuffer, size);
+  }
 
-    for(int i = 0; i < size; ++i, lhsSample++, rhsSample++)
-    {
-      *lhsSample = *rhsSample;
-    }
+  void copy(class_type const &rhs, int iOffset, int iCount)
+  {
+    span(iOffset, iCount).copy(rhs.span(iOffset, iCount));
   }
 
   void adjustGain(TJBox_Float32 iGain)
@@ -61,66 +231,227 @@ public:
     if(iGain == Volume_Init_Value)
       return;
 
-    for(TJBox_Int32 i = 0; i < size; i++)
-    {
-      fAudioBuffer[i] *= iGain;
-    }
+    dsp::adjustGain(fAudioBuffer, iGain, size);
+  }
+
+  void adjustGain(TJBox_Float32 iGain, int iOffset, int iCount)
+  {
+    span(iOffset, iCount).adjustGain(iGain);
+  }
+
+  /**
+   * Applies a gain which moves linearly (per sample) from `iFromGain` to `iToGain` (reached at the start of the next
+   * batch) instead of a constant gain for the whole batch (which generates zipper noise when the gain changes).
+   * Typical usage with `VolumeState`:
+   *
+   * ```
+   * auto previousVolume = fVolumeState.getVolume();
+   * fVolumeState.adjustVolume(targetVolume);
+   * buffer.adjustGain(previousVolume, fVolumeState.getVolume());
+   * ```
+   */
+  void adjustGain(TJBox_Float32 iFromGain, TJBox_Float32 iToGain)
+  {
+    // no need to multiply by 1.0!
+    if(iFromGain == iToGain && iFromGain == Volume_Init_Value)
+      return;
+
+    dsp::rampGain(fAudioBuffer, iFromGain, iToGain, size);
+  }
+
+  /**
+   * Ramps the gain from `iFromGain` (at `iOffset`) to `iToGain` (reached at `iOffset + iCount`) */
+  void adjustGain(TJBox_Float32 iFromGain, TJBox_Float32 iToGain, int iOffset, int iCount)
+  {
+    span(iOffset, iCount).adjustGain(iFromGain, iToGain);
+  }
+
+  /**
+   * Applies a different gain to each sample (`iGains` must contain `size` values, ex: filled by
+   * `TOnePoleSmoother::nextBatch`) */
+  void applyGains(TJBox_Float32 const *iGains)
+  {
+    dsp::multiply(fAudioBuffer, iGains, size);
   }
 
   void clear()
   {
-    for(TJBox_Int32 i = 0; i < size; i++)
-    {
-      fAudioBuffer[i] = 0;
-    }
+    dsp::clear(fAudioBuffer, size);
   }
 
-  TJBox_AudioSample max() const
+  void clear(int iOffset, int iCount)
   {
-    TJBox_AudioSample res = 0;
+    span(iOffset, iCount).clear();
+  }
 
-    for(TJBox_Int32 i = 0; i < size; i++)
-    {
-      TJBox_AudioSample sampleValue = fAudioBuffer[i];
+  /**
+   * Replaces denormals by `0` (see `dsp::flushDenormals`) */
+  void flushDenormals()
+  {
+    dsp::flushDenormals(fAudioBuffer, size);
+  }
 
-      if(sampleValue < 0)
-        sampleValue = -sampleValue;
+  /**
+   * Soft clipping (see `dsp::softClip`): `iDrive` is the gain applied before clipping and `iMix` the dry/wet mix */
+  void softClip(TJBox_Float32 iDrive = 1.0f, TJBox_Float32 iMix = 1.0f)
+  {
+    dsp::softClip(fAudioBuffer, iDrive, iMix, size);
+  }
 
-      res = std::max(res, sampleValue);
-    }
+  /**
+   * Hard clipping to `[-1, 1]` (see `dsp::hardClip`) */
+  void hardClip(TJBox_Float32 iDrive = 1.0f, TJBox_Float32 iMix = 1.0f)
+  {
+    dsp::hardClip(fAudioBuffer, iDrive, iMix, size);
+  }
+
+  /**
+   * Asymmetric saturation (see `dsp::asymmetricClip`) */
+  void asymmetricClip(TJBox_Float32 iBias, TJBox_Float32 iDrive = 1.0f, TJBox_Float32 iMix = 1.0f)
+  {
+    dsp::asymmetricClip(fAudioBuffer, iDrive, iBias, iMix, size);
+  }
+
+  TJBox_AudioSample max() const
+  {
+    return dsp::max(fAudioBuffer, size);
+  }
 
+  /**
+   * Computes peak, sum and sum of squares in one pass (use this instead of calling `max` and `isSilent` separately) */
+  AudioBufferStats analyze() const
+  {
+    AudioBufferStats res{};
+    res.fCount = size;
+    dsp::analyze(fAudioBuffer, size, res.fPeak, res.fSum, res.fSumOfSquares);
     return res;
   }
 
   /**
-  ** Code imported from examples.
-  **
   ** @brief		Checks if a buffer is completely silent.
   ** @details	Note that everything below kJBox_SilentThreshold should be considered silent.
   **/
   bool isSilent() const
   {
-    bool silent = true;
-    for(TJBox_Int32 i = 0; i < size; i++)
-    {
-      TJBox_AudioSample sampleValue = fAudioBuffer[i];
-      if(sampleValue < kJBox_SilentThreshold)
-      {
-        sampleValue = -sampleValue;
-      }
-      if(sampleValue > kJBox_SilentThreshold)
-      {
-        silent = false;
-        break;
-      }
-    }
-    return silent;
+    return max() <= kJBox_SilentThreshold;
   }
 
 public:
-  TJBox_AudioSample fAudioBuffer[size];
+  alignas(kAudioBufferAlignment) TJBox_AudioSample fAudioBuffer[size];
 };
 
+/**
+ * Non owning view over the same region of both channels of a `TStereoAudioBuffer` (see `TStereoAudioBuffer::span`) */
+template <typename T>
+class TStereoAudioSpan
+{
+public:
+  typedef TStereoAudioSpan<T> class_type;
+  typedef TStereoAudioSpan<TJBox_AudioSample const> const_span_type;
+
+public:
+  constexpr TStereoAudioSpan(TAudioSpan<T> iLeft, TAudioSpan<T> iRight) : fLeft{iLeft}, fRight{iRight} {}
+
+  // StereoAudioSpan -> ConstStereoAudioSpan
+  template<typename U, typename = std::enable_if_t<std::is_convertible_v<U *, T *>>>
+  constexpr TStereoAudioSpan(TStereoAudioSpan<U> const &iOther) : fLeft{iOther.fLeft}, fRight{iOther.fRight} {}
+
+  constexpr int getSize() const { return fLeft.getSize(); }
+
+  inline class_type subSpan(int iOffset, int iCount) const
+  {
+    return class_type{fLeft.subSpan(iOffset, iCount), fRight.subSpan(iOffset, iCount)};
+  }
+
+  inline void accumulate(const_span_type rhs) const
+  {
+    fLeft.accumulate(rhs.fLeft);
+    fRight.accumulate(rhs.fRight);
+  }
+
+  inline void copy(const_span_type rhs) const
+  {
+    fLeft.copy(rhs.fLeft);
+    fRight.copy(rhs.fRight);
+  }
+
+  inline void adjustGain(TJBox_Float32 iGain) const
+  {
+    fLeft.adjustGain(iGain);
+    fRight.adjustGain(iGain);
+  }
+
+  /**
+   * Same as `TAudioSpan::adjustGain(iFromGain, iToGain)` for both channels in one pass */
+  inline void rampGain(TJBox_Float32 iFromGain, TJBox_Float32 iToGain) const
+  {
+    // no need to multiply by 1.0!
+    if(iFromGain == iToGain && iFromGain == Volume_Init_Value)
+      return;
+
+    dsp::rampGain(fLeft.data(), fRight.data(), iFromGain, iToGain, getSize());
+  }
+
+  inline void clear() const
+  {
+    fLeft.clear();
+    fRight.clear();
+  }
+
+  inline TJBox_AudioSample max() const
+  {
+    return std::max(fLeft.max(), fRight.max());
+  }
+
+  inline bool isSilent() const
+  {
+    return max() <= kJBox_SilentThreshold;
+  }
+
+  /**
+   * Same as `TAudioSpan::xFade` for both channels in one pass */
+  inline void xFade(const_span_type iSrc1, const_span_type iSrc2,
+                    TJBox_Float32 const *iXFade, TJBox_Float32 const *iReverseXFade) const
+  {
+    JBOX_ASSERT(iSrc1.getSize() == getSize() && iSrc2.getSize() == getSize());
+    dsp::xFade(fLeft.data(), fRight.data(),
+               iSrc1.fLeft.data(), iSrc1.fRight.data(),
+               iSrc2.fLeft.data(), iSrc2.fRight.data(),
+               iXFade, iReverseXFade, getSize());
+  }
+
+  /**
+   * Same as `TStereoAudioBuffer::midSideEncode` */
+  inline void midSideEncode() const
+  {
+    dsp::midSideEncode(fLeft.data(), fRight.data(), getSize());
+  }
+
+  /**
+   * Same as `TStereoAudioBuffer::midSideDecode` */
+  inline void midSideDecode() const
+  {
+    dsp::midSideDecode(fLeft.data(), fRight.data(), getSize());
+  }
+
+  /**
+   * Same as `TStereoAudioBuffer::width` */
+  inline void width(TJBox_Float32 iWidth) const
+  {
+    if(iWidth == 1.0f)
+      return;
+
+    dsp::stereoWidth(fLeft.data(), fRight.data(), iWidth, getSize());
+  }
+
+public:
+  TAudioSpan<T> fLeft;
+  TAudioSpan<T> fRight;
+};
+
+typedef TStereoAudioSpan<TJBox_AudioSample> StereoAudioSpan;
+typedef TStereoAudioSpan<TJBox_AudioSample const> ConstStereoAudioSpan;
+
 template <int size = kBatchSize>
 class TStereoAudioBuffer
 {
@@ -133,38 +464,358 @@ public:
 public:
   constexpr int getSize() const { return size; }
 
+  /**
+   * Both channels are stored contiguously, in planar layout (`[left samples][right samples]`, without padding), when
+   * `size` is a multiple of the alignment (16 samples). In this case, the stereo operations process the `2 * size`
+   * samples in one pass.
+   *
+   * @note this relies on the 2 members being adjacent (checked in `data()` with `offsetof`): the `2 * size` samples
+   *       returned by `data()` span `fLeftAudioBuffer` and `fRightAudioBuffer`, so do not add members between them */
+  static constexpr bool kIsPlanar = sizeof(TAudioBuffer<size>) == size * sizeof(TJBox_AudioSample);
+
+  /**
+   * @return the `2 * size` samples (left channel followed by right channel) (requires `kIsPlanar`) */
+  inline TJBox_AudioSample *data()
+  {
+    static_assert(kIsPlanar, "size must be a multiple of 16 for contiguous storage");
+    static_assert(offsetof(class_type, fRightAudioBuffer) == sizeof(TAudioBuffer<size>),
+                  "the right channel must directly follow the left channel");
+    return fLeftAudioBuffer.fAudioBuffer;
+  }
+
+  /**
+   * @return the `2 * size` samples (left channel followed by right channel) (requires `kIsPlanar`) */
+  inline TJBox_AudioSample const *data() const
+  {
+    static_assert(kIsPlanar, "size must be a multiple of 16 for contiguous storage");
+    static_assert(offsetof(class_type, fRightAudioBuffer) == sizeof(TAudioBuffer<size>),
+                  "the right channel must directly follow the left channel");
+    return fLeftAudioBuffer.fAudioBuffer;
+  }
+
+  /**
+   * @return a (non owning) view over the samples `[iOffset, iOffset + iCount)` of both channels */
+  inline StereoAudioSpan span(int iOffset = 0, int iCount = size)
+  {
+    return StereoAudioSpan{fLeftAudioBuffer.span(iOffset, iCount), fRightAudioBuffer.span(iOffset, iCount)};
+  }
+
+  /**
+   * @return a (non owning, read only) view over the samples `[iOffset, iOffset + iCount)` of both channels */
+  inline ConstStereoAudioSpan span(int iOffset = 0, int iCount = size) const
+  {
+    return ConstStereoAudioSpan{fLeftAudioBuffer.span(iOffset, iCount), fRightAudioBuffer.span(iOffset, iCount)};
+  }
+
   inline void accumulate(class_type const &rhs)
   {
-    fLeftAudioBuffer.accumulate(rhs.fLeftAudioBuffer);
-    fRightAudioBuffer.accumulate(rhs.fRightAudioBuffer);
+    if constexpr(kIsPlanar)
+      dsp::accumulate(data(), rhs.data(), 2 * size);
+    else
+    {
+      fLeftAudioBuffer.accumulate(rhs.fLeftAudioBuffer);
+      fRightAudioBuffer.accumulate(rhs.fRightAudioBuffer);
+    }
   }
 
   inline void adjustGain(TJBox_Float32 iGain)
   {
-    fLeftAudioBuffer.adjustGain(iGain);
-    fRightAudioBuffer.adjustGain(iGain);
+    if constexpr(kIsPlanar)
+    {
+      // no need to multiply by 1.0!
+      if(iGain != Volume_Init_Value)
+        dsp::adjustGain(data(), iGain, 2 * size);
+    }
+    else
+    {
+      fLeftAudioBuffer.adjustGain(iGain);
+      fRightAudioBuffer.adjustGain(iGain);
+    }
+  }
+
+  /**
+   * Same as `TAudioBuffer::adjustGain(iFromGain, iToGain)` for both channels in one pass */
+  inline void rampGain(TJBox_Float32 iFromGain, TJBox_Float32 iToGain)
+  {
+    // no need to multiply by 1.0!
+    if(iFromGain == iToGain && iFromGain == Volume_Init_Value)
+      return;
+
+    dsp::rampGain(fLeftAudioBuffer.fAudioBuffer, fRightAudioBuffer.fAudioBuffer, iFromGain, iToGain, size);
   }
 
   inline void clear()
   {
-    fLeftAudioBuffer.clear();
-    fRightAudioBuffer.clear();
+    if constexpr(kIsPlanar)
+      dsp::clear(data(), 2 * size);
+    else
+    {
+      fLeftAudioBuffer.clear();
+      fRightAudioBuffer.clear();
+    }
+  }
+
+  inline void flushDenormals()
+  {
+    if constexpr(kIsPlanar)
+      dsp::flushDenormals(data(), 2 * size);
+    else
+    {
+      fLeftAudioBuffer.flushDenormals();
+      fRightAudioBuffer.flushDenormals();
+    }
+  }
+
+  /**
+   * Same as `TAudioBuffer::softClip` for both channels */
+  inline void softClip(TJBox_Float32 iDrive = 1.0f, TJBox_Float32 iMix = 1.0f)
+  {
+    if constexpr(kIsPlanar)
+      dsp::softClip(data(), iDrive, iMix, 2 * size);
+    else
+    {
+      fLeftAudioBuffer.softClip(iDrive, iMix);
+      fRightAudioBuffer.softClip(iDrive, iMix);
+    }
+  }
+
+  /**
+   * Same as `TAudioBuffer::hardClip` for both channels */
+  inline void hardClip(TJBox_Float32 iDrive = 1.0f, TJBox_Float32 iMix = 1.0f)
+  {
+    if constexpr(kIsPlanar)
+      dsp::hardClip(data(), iDrive, iMix, 2 * size);
+    else
+    {
+      fLeftAudioBuffer.hardClip(iDrive, iMix);
+      fRightAudioBuffer.hardClip(iDrive, iMix);
+    }
+  }
+
+  /**
+   * Same as `TAudioBuffer::asymmetricClip` for both channels */
+  inline void asymmetricClip(TJBox_Float32 iBias, TJBox_Float32 iDrive = 1.0f, TJBox_Float32 iMix = 1.0f)
+  {
+    if constexpr(kIsPlanar)
+      dsp::asymmetricClip(data(), iDrive, iBias, iMix, 2 * size);
+    else
+    {
+      fLeftAudioBuffer.asymmetricClip(iBias, iDrive, iMix);
+      fRightAudioBuffer.asymmetricClip(iBias, iDrive, iMix);
+    }
   }
 
   inline void copy(class_type const &rhs)
   {
-    fLeftAudioBuffer.copy(rhs.fLeftAudioBuffer);
-    fRightAudioBuffer.copy(rhs.fRightAudioBuffer);
+    if constexpr(kIsPlanar)
+      dsp::copy(data(), rhs.data(), 2 * size);
+    else
+    {
+      fLeftAudioBuffer.copy(rhs.fLeftAudioBuffer);
+      fRightAudioBuffer.copy(rhs.fRightAudioBuffer);
+    }
+  }
+
+  /**
+   * Sub block versions: only the samples `[iOffset, iOffset + iCount)` (of both channels) are processed */
+  inline void accumulate(class_type const &rhs, int iOffset, int iCount)
+  {
+    span(iOffset, iCount).accumulate(rhs.span(iOffset, iCount));
+  }
+
+  inline void copy(class_type const &rhs, int iOffset, int iCount)
+  {
+    span(iOffset, iCount).copy(rhs.span(iOffset, iCount));
+  }
+
+  inline void adjustGain(TJBox_Float32 iGain, int iOffset, int iCount)
+  {
+    span(iOffset, iCount).adjustGain(iGain);
+  }
+
+  /**
+   * Ramps the gain from `iFromGain` (at `iOffset`) to `iToGain` (reached at `iOffset + iCount`) */
+  inline void rampGain(TJBox_Float32 iFromGain, TJBox_Float32 iToGain, int iOffset, int iCount)
+  {
+    span(iOffset, iCount).rampGain(iFromGain, iToGain);
+  }
+
+  inline void clear(int iOffset, int iCount)
+  {
+    span(iOffset, iCount).clear();
+  }
+
+  /**
+   * Applies a different gain to each channel in one pass */
+  inline void adjustGain(PanGains const &iGains)
+  {
+    // no need to multiply by 1.0!
+    if(iGains.fLeft == Volume_Init_Value && iGains.fRight == Volume_Init_Value)
+      return;
+
+    dsp::adjustGain(fLeftAudioBuffer.fAudioBuffer, fRightAudioBuffer.fAudioBuffer, iGains.fLeft, iGains.fRight, size);
+  }
+
+  /**
+   * Same as `rampGain(iFromGain, iToGain)` with a different ramp for each channel */
+  inline void rampGain(PanGains const &iFromGains, PanGains const &iToGains)
+  {
+    dsp::rampGain(fLeftAudioBuffer.fAudioBuffer, fRightAudioBuffer.fAudioBuffer,
+                  iFromGains.fLeft, iToGains.fLeft, iFromGains.fRight, iToGains.fRight, size);
+  }
+
+  /**
+   * Constant power pan (see `computePanGains`) with `iPan` in `[-1, 1]` */
+  inline void pan(TJBox_Float32 iPan)
+  {
+    adjustGain(computePanGains(iPan));
+  }
+
+  /**
+   * Pan moving from `iFromPan` to `iToPan` during the batch (the gains are ramped linearly between the constant power
+   * gains of both positions, which is inaudible over one batch) */
+  inline void pan(TJBox_Float32 iFromPan, TJBox_Float32 iToPan)
+  {
+    if(iFromPan == iToPan)
+      pan(iFromPan);
+    else
+      rampGain(computePanGains(iFromPan), computePanGains(iToPan));
+  }
+
+  /**
+   * Balance (see `computeBalanceGains`) with `iBalance` in `[-1, 1]` */
+  inline void balance(TJBox_Float32 iBalance)
+  {
+    adjustGain(computeBalanceGains(iBalance));
+  }
+
+  /**
+   * Same as `pan(iFromPan, iToPan)` for balance */
+  inline void balance(TJBox_Float32 iFromBalance, TJBox_Float32 iToBalance)
+  {
+    if(iFromBalance == iToBalance)
+      balance(iFromBalance);
+    else
+      rampGain(computeBalanceGains(iFromBalance), computeBalanceGains(iToBalance));
+  }
+
+  /**
+   * Converts the buffer into mid (left channel) / side (right channel) in place (see `dsp::midSideEncode`) so that
+   * processing can be applied to the mid and side signals directly. Call `midSideDecode` to go back to left/right. */
+  inline void midSideEncode()
+  {
+    dsp::midSideEncode(fLeftAudioBuffer.fAudioBuffer, fRightAudioBuffer.fAudioBuffer, size);
+  }
+
+  /**
+   * Converts the buffer back from mid/side (see `midSideEncode`) into left/right in place */
+  inline void midSideDecode()
+  {
+    dsp::midSideDecode(fLeftAudioBuffer.fAudioBuffer, fRightAudioBuffer.fAudioBuffer, size);
+  }
+
+  /**
+   * Adjusts the stereo width in place and in one pass (see `dsp::stereoWidth`): `0` is mono, `1` is unchanged and
+   * `> 1` is wider */
+  inline void width(TJBox_Float32 iWidth)
+  {
+    // unchanged
+    if(iWidth == 1.0f)
+      return;
+
+    dsp::stereoWidth(fLeftAudioBuffer.fAudioBuffer, fRightAudioBuffer.fAudioBuffer, iWidth, size);
+  }
+
+  /**
+   * Same as `TAudioBuffer::applyGains` for both channels */
+  inline void applyGains(TJBox_Float32 const *iGains)
+  {
+    fLeftAudioBuffer.applyGains(iGains);
+    fRightAudioBuffer.applyGains(iGains);
   }
 
   inline TJBox_AudioSample max() const
   {
-    return std::max(fLeftAudioBuffer.max(), fRightAudioBuffer.max());
+    if constexpr(kIsPlanar)
+      return dsp::max(data(), 2 * size);
+    else
+      return std::max(fLeftAudioBuffer.max(), fRightAudioBuffer.max());
+  }
+
+  inline bool isSilent() const
+  {
+    return max() <= kJBox_SilentThreshold;
+  }
+
+  /**
+   * Non owning view which presents the samples of a stereo buffer interleaved (`L0 R0 L1 R1 ...`) without copying
+   * them. Use `interleave` instead when a contiguous interleaved copy is needed (ex: to write a file). */
+  class InterleavedView
+  {
+  public:
+    explicit InterleavedView(class_type &iBuffer) : fBuffer{iBuffer} {}
+
+    constexpr int getSize() const { return 2 * size; }
+
+    inline TJBox_AudioSample &operator[](int iIndex)
+    {
+      auto &channel = (iIndex & 1) == 0 ? fBuffer.fLeftAudioBuffer : fBuffer.fRightAudioBuffer;
+      return channel.fAudioBuffer[iIndex >> 1];
+    }
+
+  private:
+    class_type &fBuffer;
+  };
+
+  inline InterleavedView interleaved() { return InterleavedView{*this}; }
+
+  /**
+   * Copies the samples into `oInterleaved` (which must be able to hold `2 * size` samples) as `L0 R0 L1 R1 ...` */
+  void interleave(TJBox_AudioSample *oInterleaved) const
+  {
+    for(int i = 0; i < size; i++)
+    {
+      *oInterleaved++ = fLeftAudioBuffer.fAudioBuffer[i];
+      *oInterleaved++ = fRightAudioBuffer.fAudioBuffer[i];
+    }
+  }
+
+  /**
+   * Inverse of `interleave` */
+  void deinterleave(TJBox_AudioSample const *iInterleaved)
+  {
+    for(int i = 0; i < size; i++)
+    {
+      fLeftAudioBuffer.fAudioBuffer[i] = *iInterleaved++;
+      fRightAudioBuffer.fAudioBuffer[i] = *iInterleaved++;
+    }
+  }
+
+  /**
+   * Analyzes both channels (single pass when `kIsPlanar`) and returns the combined stats */
+  inline AudioBufferStats analyze() const
+  {
+    AudioBufferStats res{};
+    if constexpr(kIsPlanar)
+    {
+      res.fCount = 2 * size;
+      dsp::analyze(data(), 2 * size, res.fPeak, res.fSum, res.fSumOfSquares);
+    }
+    else
+    {
+      AudioBufferStats right{};
+      analyze(res, right);
+      res.merge(right);
+    }
+    return res;
   }
 
-  inline bool isSilent()
+  /**
+   * Analyzes both channels (one pass each) and returns the stats per channel */
+  inline void analyze(AudioBufferStats &oLeftStats, AudioBufferStats &oRightStats) const
   {
-    return fLeftAudioBuffer.isSilent() && fRightAudioBuffer.isSilent();
+    oLeftStats = fLeftAudioBuffer.analyze();
+    oRightStats = fRightAudioBuffer.analyze();
   }
 
   void xFade(XFade<size> const &iXFade, class_type const &other)
@@ -172,38 +823,215 @@ public:
     xFade(iXFade, *this, other);
   }
 
+  /**
+   * Converts the curve (see `XFade::toXFadeTable`): use an `XFadeCurve` to skip the conversion */
   void xFade(XFade<size> const &iXFade, class_type const &sab1, class_type const &sab2)
   {
-    const TJBox_Float64 *xFadeFunction = iXFade.fXFadeFunction;
-    const TJBox_Float64 *vReverseXFadeFunction = &iXFade.fXFadeFunction[size - 1];
+    auto const table = iXFade.toXFadeTable();
+    xFade(XFadeCurve<size>{table}, sab1, sab2);
+  }
+
+  void xFade(XFade<size> const &iXFade, class_type const &sab1, class_type const &sab2, int iOffset, int iCount)
+  {
+    auto const table = iXFade.toXFadeTable();
+    xFade(XFadeCurve<size>{table}, sab1, sab2, iOffset, iCount);
+  }
 
-    TJBox_AudioSample* vLeftAudioBuffer = fLeftAudioBuffer.fAudioBuffer;
-    TJBox_AudioSample* vRightAudioBuffer = fRightAudioBuffer.fAudioBuffer;
+  void xFade(XFadeCurve<size> const &iXFade, class_type const &other)
+  {
+    xFade(iXFade, *this, other);
+  }
 
-    const TJBox_AudioSample *vLAB1 = sab1.fLeftAudioBuffer.fAudioBuffer;
-    const TJBox_AudioSample *vRAB1 = sab1.fRightAudioBuffer.fAudioBuffer;
+  void xFade(XFadeCurve<size> const &iXFade, class_type const &sab1, class_type const &sab2)
+  {
+    dsp::xFade(fLeftAudioBuffer.fAudioBuffer, fRightAudioBuffer.fAudioBuffer,
+               sab1.fLeftAudioBuffer.fAudioBuffer, sab1.fRightAudioBuffer.fAudioBuffer,
+               sab2.fLeftAudioBuffer.fAudioBuffer, sab2.fRightAudioBuffer.fAudioBuffer,
+               iXFade.fXFadeFunction, iXFade.fReverseXFadeFunction, size);
+  }
 
-    const TJBox_AudioSample *vLAB2 = sab2.fLeftAudioBuffer.fAudioBuffer;
-    const TJBox_AudioSample *vRAB2 = sab2.fRightAudioBuffer.fAudioBuffer;
+  /**
+   * Sub block version: the samples `[iOffset, iOffset + iCount)` are cross faded using the same portion of the curve
+   * (so that splitting a batch in several sub blocks produces the same result as the full version) */
+  void xFade(XFadeCurve<size> const &iXFade, class_type const &sab1, class_type const &sab2, int iOffset, int iCount)
+  {
+    span(iOffset, iCount).xFade(sab1.span(iOffset, iCount), sab2.span(iOffset, iCount),
+                                iXFade.fXFadeFunction + iOffset, iXFade.fReverseXFadeFunction + iOffset);
+  }
 
-    for(int i = 0; i < size; i++)
+public:
+  TAudioBuffer<size> fLeftAudioBuffer;
+  TAudioBuffer<size> fRightAudioBuffer;
+};
+
+/**
+ * Generalization of `TStereoAudioBuffer` to any (compile time) number of channels (ex: 4 for quad, 6 for 5.1). The
+ * channels are stored contiguously (see `TStereoAudioBuffer::kIsPlanar`) so every operation is a single loop over
+ * `channels * size` samples. */
+template <int channels, int size = kBatchSize>
+class TMultiChannelAudioBuffer
+{
+  static_assert(channels > 0, "at least 1 channel required");
+
+public:
+  typedef TMultiChannelAudioBuffer<channels, size> class_type;
+
+  static constexpr bool kIsPlanar = sizeof(TAudioBuffer<size>) == size * sizeof(TJBox_AudioSample);
+
+public:
+  TMultiChannelAudioBuffer() {}
+
+public:
+  constexpr int getSize() const { return size; }
+
+  constexpr int getChannelCount() const { return channels; }
+
+  inline TAudioBuffer<size> &getChannel(int iChannel) { return fChannels[iChannel]; }
+
+  inline TAudioBuffer<size> const &getChannel(int iChannel) const { return fChannels[iChannel]; }
+
+  /**
+   * @return the `channels * size` samples (channel 0 first) (requires `kIsPlanar`) */
+  inline TJBox_AudioSample *data()
+  {
+    static_assert(kIsPlanar, "size must be a multiple of 16 for contiguous storage");
+    return fChannels[0].fAudioBuffer;
+  }
+
+  /**
+   * @return the `channels * size` samples (channel 0 first) (requires `kIsPlanar`) */
+  inline TJBox_AudioSample const *data() const
+  {
+    static_assert(kIsPlanar, "size must be a multiple of 16 for contiguous storage");
+    return fChannels[0].fAudioBuffer;
+  }
+
+  inline void accumulate(class_type const &rhs)
+  {
+    if constexpr(kIsPlanar)
+      dsp::accumulate(data(), rhs.data(), channels * size);
+    else
+      for(int c = 0; c < channels; c++)
+        fChannels[c].accumulate(rhs.fChannels[c]);
+  }
+
+  inline void adjustGain(TJBox_Float32 iGain)
+  {
+    // no need to multiply by 1.0!
+    if(iGain == Volume_Init_Value)
+      return;
+
+    if constexpr(kIsPlanar)
+      dsp::adjustGain(data(), iGain, channels * size);
+    else
+      for(int c = 0; c < channels; c++)
+        fChannels[c].adjustGain(iGain);
+  }
+
+  /**
+   * Same as `TAudioBuffer::adjustGain(iFromGain, iToGain)` for all channels */
+  inline void rampGain(TJBox_Float32 iFromGain, TJBox_Float32 iToGain)
+  {
+    for(int c = 0; c < channels; c++)
+      fChannels[c].adjustGain(iFromGain, iToGain);
+  }
+
+  inline void clear()
+  {
+    if constexpr(kIsPlanar)
+      dsp::clear(data(), channels * size);
+    else
+      for(int c = 0; c < channels; c++)
+        fChannels[c].clear();
+  }
+
+  inline void flushDenormals()
+  {
+    if constexpr(kIsPlanar)
+      dsp::flushDenormals(data(), channels * size);
+    else
+      for(int c = 0; c < channels; c++)
+        fChannels[c].flushDenormals();
+  }
+
+  inline void copy(class_type const &rhs)
+  {
+    if constexpr(kIsPlanar)
+      dsp::copy(data(), rhs.data(), channels * size);
+    else
+      for(int c = 0; c < channels; c++)
+        fChannels[c].copy(rhs.fChannels[c]);
+  }
+
+  inline TJBox_AudioSample max() const
+  {
+    if constexpr(kIsPlanar)
+      return dsp::max(data(), channels * size);
+    else
     {
-      TJBox_Float64 vXFade = *xFadeFunction++;
-      TJBox_Float64 vReverseXFade = *vReverseXFadeFunction--;
+      TJBox_AudioSample res = 0;
+      for(int c = 0; c < channels; c++)
+        res = std::max(res, fChannels[c].max());
+      return res;
+    }
+  }
 
-      *vLeftAudioBuffer++ =
-        (TJBox_AudioSample) ((*vLAB1++ * vXFade) + (*vLAB2++ * vReverseXFade));
-      *vRightAudioBuffer++ =
-        (TJBox_AudioSample) ((*vRAB1++ * vXFade) + (*vRAB2++ * vReverseXFade));
+  inline bool isSilent() const
+  {
+    return max() <= kJBox_SilentThreshold;
+  }
+
+  /**
+   * Analyzes all channels and returns the combined stats */
+  inline AudioBufferStats analyze() const
+  {
+    AudioBufferStats res{};
+    if constexpr(kIsPlanar)
+    {
+      res.fCount = channels * size;
+      dsp::analyze(data(), channels * size, res.fPeak, res.fSum, res.fSumOfSquares);
+    }
+    else
+      for(int c = 0; c < channels; c++)
+        res.merge(fChannels[c].analyze());
+    return res;
+  }
+
+  void xFade(XFade<size> const &iXFade, class_type const &other)
+  {
+    xFade(iXFade, *this, other);
+  }
+
+  /**
+   * Same as `TStereoAudioBuffer::xFade` for all channels */
+  void xFade(XFade<size> const &iXFade, class_type const &mab1, class_type const &mab2)
+  {
+    auto const table = iXFade.toXFadeTable();
+    xFade(XFadeCurve<size>{table}, mab1, mab2);
+  }
+
+  void xFade(XFadeCurve<size> const &iXFade, class_type const &other)
+  {
+    xFade(iXFade, *this, other);
+  }
+
+  void xFade(XFadeCurve<size> const &iXFade, class_type const &mab1, class_type const &mab2)
+  {
+    for(int c = 0; c < channels; c++)
+    {
+      dsp::xFade(fChannels[c].fAudioBuffer, mab1.fChannels[c].fAudioBuffer, mab2.fChannels[c].fAudioBuffer,
+                 iXFade.fXFadeFunction, iXFade.fReverseXFadeFunction, size);
     }
   }
 
 public:
-  TAudioBuffer<size> fLeftAudioBuffer;
-  TAudioBuffer<size> fRightAudioBuffer;
+  TAudioBuffer<size> fChannels[channels];
 };
 
 typedef TAudioBuffer<kBatchSize> AudioBuffer;
 typedef TStereoAudioBuffer<kBatchSize> StereoAudioBuffer;
 
+template<int channels>
+using MultiChannelAudioBuffer = TMultiChannelAudioBuffer<channels, kBatchSize>;
+
 #endif //__AudioBuffer_H_
@@ -9,6 +9,8 @@
 #include "JBoxPropertyManager.h"
 #include "JBoxProperty.h"
 #include "AudioBuffer.h"
+#include <array>
+#include <utility>
 
 /**
 * AudioSocket
@@ -81,6 +83,20 @@ public:
     return false;
   }
 
+  /**
+   * Same as `maybeWriteAudio` but reuses stats already computed (ex: for metering) instead of scanning the buffer */
+  template<int size>
+  inline bool maybeWriteAudio(TAudioBuffer<size> const &iAudioBuffer, AudioBufferStats const &iStats) const
+  {
+    if(!iStats.isSilent())
+    {
+      writeAudio(iAudioBuffer);
+      return true;
+    }
+
+    return false;
+  }
+
 };
 
 /**
@@ -184,8 +200,133 @@ public:
     return res;
   }
 
+  template<int size>
+  bool maybeWriteAudio(TStereoAudioBuffer<size> const &iStereoAudioBuffer,
+                       AudioBufferStats const &iLeftStats,
+                       AudioBufferStats const &iRightStats) const
+  {
+    bool res = false;
+    res |= fLeftSocket.maybeWriteAudio(iStereoAudioBuffer.fLeftAudioBuffer, iLeftStats);
+    res |= fRightSocket.maybeWriteAudio(iStereoAudioBuffer.fRightAudioBuffer, iRightStats);
+    return res;
+  }
+
   AudioOutSocket fLeftSocket;
   AudioOutSocket fRightSocket;
 };
 
+/**
+ * Generalization of `StereoInPair` to any number of channels (ex: quad or 5.1). Example:
+ *
+ * ```
+ * TMultiChannelInSockets<4> fQuadIn{{"inFrontLeft", "inFrontRight", "inRearLeft", "inRearRight"}};
+ * ```
+ */
+template<int channels>
+class TMultiChannelInSockets
+{
+public:
+  explicit TMultiChannelInSockets(std::array<char const *, channels> const &iSocketNames) :
+    fSockets{makeSockets(iSocketNames, std::make_index_sequence<channels>{})}
+  {
+  }
+
+  void registerForUpdate(IJBoxPropertyManager &manager)
+  {
+    for(auto &socket: fSockets)
+      socket.registerForUpdate(manager);
+  }
+
+  /**
+   * @return `true` if at least one socket is connected */
+  inline TJBox_Bool isConnected() const
+  {
+    for(auto const &socket: fSockets)
+    {
+      if(socket.isConnected())
+        return true;
+    }
+    return false;
+  }
+
+  inline AudioInSocket const &getSocket(int iChannel) const { return fSockets[iChannel]; }
+
+  template<int size>
+  void readAudio(TMultiChannelAudioBuffer<channels, size> &iAudioBuffer) const
+  {
+    for(int c = 0; c < channels; c++)
+      fSockets[c].readAudio(iAudioBuffer.fChannels[c]);
+  }
+
+private:
+  template<std::size_t... I>
+  static std::array<AudioInSocket, channels> makeSockets(std::array<char const *, channels> const &iSocketNames,
+                                                         std::index_sequence<I...>)
+  {
+    return {AudioInSocket(iSocketNames[I])...};
+  }
+
+private:
+  std::array<AudioInSocket, channels> fSockets;
+};
+
+/**
+ * Generalization of `StereoOutPair` to any number of channels (ex: quad or 5.1). */
+template<int channels>
+class TMultiChannelOutSockets
+{
+public:
+  explicit TMultiChannelOutSockets(std::array<char const *, channels> const &iSocketNames) :
+    fSockets{makeSockets(iSocketNames, std::make_index_sequence<channels>{})}
+  {
+  }
+
+  void registerForUpdate(IJBoxPropertyManager &manager)
+  {
+    for(auto &socket: fSockets)
+      socket.registerForUpdate(manager);
+  }
+
+  /**
+   * @return `true` if at least one socket is connected */
+  inline TJBox_Bool isConnected() const
+  {
+    for(auto const &socket: fSockets)
+    {
+      if(socket.isConnected())
+        return true;
+    }
+    return false;
+  }
+
+  inline AudioOutSocket const &getSocket(int iChannel) const { return fSockets[iChannel]; }
+
+  template<int size>
+  void writeAudio(TMultiChannelAudioBuffer<channels, size> const &iAudioBuffer) const
+  {
+    for(int c = 0; c < channels; c++)
+      fSockets[c].writeAudio(iAudioBuffer.fChannels[c]);
+  }
+
+  template<int size>
+  bool maybeWriteAudio(TMultiChannelAudioBuffer<channels, size> const &iAudioBuffer) const
+  {
+    bool res = false;
+    for(int c = 0; c < channels; c++)
+      res |= fSockets[c].maybeWriteAudio(iAudioBuffer.fChannels[c]);
+    return res;
+  }
+
+private:
+  template<std::size_t... I>
+  static std::array<AudioOutSocket, channels> makeSockets(std::array<char const *, channels> const &iSocketNames,
+                                                          std::index_sequence<I...>)
+  {
+    return {AudioOutSocket(iSocketNames[I])...};
+  }
+
+private:
+  std::array<AudioOutSocket, channels> fSockets;
+};
+
 #endif //__PongasoftCommon_AudioSocket_h__
@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_Biquad_h__
+#define __PongasoftCommon_Biquad_h__
+
+#include "AudioBuffer.h"
+#include "Constants.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Filter types (see "Cookbook formulae for audio EQ biquad filter coefficients" by Robert Bristow-Johnson). `fGainDb`
+ * is only used by `kPeak`, `kLowShelf` and `kHighShelf`. */
+enum class EBiquadType
+{
+  kLowPass,
+  kHighPass,
+  kBandPass, // constant 0dB peak gain
+  kNotch,
+  kAllPass,
+  kPeak,
+  kLowShelf,
+  kHighShelf
+};
+
+/**
+ * Normalized coefficients (`a0 = 1`) of `H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)`. The default is
+ * the identity filter. */
+struct BiquadCoefficients
+{
+  TJBox_Float32 fB0{1};
+  TJBox_Float32 fB1{0};
+  TJBox_Float32 fB2{0};
+  TJBox_Float32 fA1{0};
+  TJBox_Float32 fA2{0};
+
+  inline bool operator==(BiquadCoefficients const &rhs) const
+  {
+    return fB0 == rhs.fB0 && fB1 == rhs.fB1 && fB2 == rhs.fB2 && fA1 == rhs.fA1 && fA2 == rhs.fA2;
+  }
+
+  inline bool operator!=(BiquadCoefficients const &rhs) const { return !(*this == rhs); }
+};
+
+/**
+ * What defines a filter design (and the key of the `BiquadDesigner` cache) */
+struct BiquadParameters
+{
+  EBiquadType fType{EBiquadType::kLowPass};
+  TJBox_Float32 fFrequency{1000}; // Hz
+  TJBox_Float32 fQ{0.707106781f}; // 1/sqrt(2) (Butterworth)
+  TJBox_Float32 fGainDb{0};
+  int fSampleRate{44100};
+
+  inline bool operator==(BiquadParameters const &rhs) const
+  {
+    return fType == rhs.fType && fFrequency == rhs.fFrequency && fQ == rhs.fQ && fGainDb == rhs.fGainDb &&
+           fSampleRate == rhs.fSampleRate;
+  }
+
+  inline bool operator!=(BiquadParameters const &rhs) const { return !(*this == rhs); }
+};
+
+namespace BiquadImpl {
+
+/**
+ * Computes the coefficients (in double precision). The frequency is clamped to `[1Hz, 0.49 * sample rate]` and `Q`
+ * to a minimum of `0.01`. */
+inline BiquadCoefficients design(BiquadParameters const &iParams)
+{
+  auto const sampleRate = static_cast<TJBox_Float64>(iParams.fSampleRate);
+  auto const frequency = std::clamp(static_cast<TJBox_Float64>(iParams.fFrequency), 1.0, 0.49 * sampleRate);
+  auto const q = std::max(static_cast<TJBox_Float64>(iParams.fQ), 0.01);
+  auto const w0 = 2.0 * kPi * frequency / sampleRate;
+  auto const cosW0 = std::cos(w0);
+  auto const alpha = std::sin(w0) / (2.0 * q);
+  auto const A = std::pow(10.0, iParams.fGainDb / 40.0);
+  auto const sqrtAAlpha = 2.0 * std::sqrt(A) * alpha;
+
+  TJBox_Float64 b0, b1, b2, a0, a1, a2;
+
+  switch(iParams.fType)
+  {
+    case EBiquadType::kLowPass:
+      b0 = (1.0 - cosW0) / 2.0; b1 = 1.0 - cosW0; b2 = b0;
+      a0 = 1.0 + alpha; a1 = -2.0 * cosW0; a2 = 1.0 - alpha;
+      break;
+
+    case EBiquadType::kHighPass:
+      b0 = (1.0 + cosW0) / 2.0; b1 = -(1.0 + cosW0); b2 = b0;
+      a0 = 1.0 + alpha; a1 = -2.0 * cosW0; a2 = 1.0 - alpha;
+      break;
+
+    case EBiquadType::kBandPass:
+      b0 = alpha; b1 = 0; b2 = -alpha;
+      a0 = 1.0 + alpha; a1 = -2.0 * cosW0; a2 = 1.0 - alpha;
+      break;
+
+    case EBiquadType::kNotch:
+      b0 = 1.0; b1 = -2.0 * cosW0; b2 = 1.0;
+      a0 = 1.0 + alpha; a1 = -2.0 * cosW0; a2 = 1.0 - alpha;
+      break;
+
+    case EBiquadType::kAllPass:
+      b0 = 1.0 - alpha; b1 = -2.0 * cosW0; b2 = 1.0 + alpha;
+      a0 = 1.0 + alpha; a1 = -2.0 * cosW0; a2 = 1.0 - alpha;
+      break;
+
+    case EBiquadType::kPeak:
+      b0 = 1.0 + alpha * A; b1 = -2.0 * cosW0; b2 = 1.0 - alpha * A;
+      a0 = 1.0 + alpha / A; a1 = -2.0 * cosW0; a2 = 1.0 - alpha / A;
+      break;
+
+    case EBiquadType::kLowShelf:
+      b0 = A * ((A + 1.0) - (A - 1.0) * cosW0 + sqrtAAlpha);
+      b1 = 2.0 * A * ((A - 1.0) - (A + 1.0) * cosW0);
+      b2 = A * ((A + 1.0) - (A - 1.0) * cosW0 - sqrtAAlpha);
+      a0 = (A + 1.0) + (A - 1.0) * cosW0 + sqrtAAlpha;
+      a1 = -2.0 * ((A - 1.0) + (A + 1.0) * cosW0);
+      a2 = (A + 1.0) + (A - 1.0) * cosW0 - sqrtAAlpha;
+      break;
+
+    case EBiquadType::kHighShelf:
+      b0 = A * ((A + 1.0) + (A - 1.0) * cosW0 + sqrtAAlpha);
+      b1 = -2.0 * A * ((A - 1.0) + (A + 1.0) * cosW0);
+      b2 = A * ((A + 1.0) + (A - 1.0) * cosW0 - sqrtAAlpha);
+      a0 = (A + 1.0) - (A - 1.0) * cosW0 + sqrtAAlpha;
+      a1 = 2.0 * ((A - 1.0) - (A + 1.0) * cosW0);
+      a2 = (A + 1.0) - (A - 1.0) * cosW0 - sqrtAAlpha;
+      break;
+
+    default:
+      return {};
+  }
+
+  return {
+    static_cast<TJBox_Float32>(b0 / a0),
+    static_cast<TJBox_Float32>(b1 / a0),
+    static_cast<TJBox_Float32>(b2 / a0),
+    static_cast<TJBox_Float32>(a1 / a0),
+    static_cast<TJBox_Float32>(a2 / a0)
+  };
+}
+
+/**
+ * Transposed direct form II state (one per channel and per stage) */
+struct State
+{
+  TJBox_Float32 fS1{0};
+  TJBox_Float32 fS2{0};
+
+  inline void flushDenormals()
+  {
+    fS1 = dsp::flushDenormal(fS1);
+    fS2 = dsp::flushDenormal(fS2);
+  }
+};
+
+// one sample of transposed direct form II
+inline TJBox_AudioSample tick(TJBox_Float32 b0, TJBox_Float32 b1, TJBox_Float32 b2, TJBox_Float32 a1, TJBox_Float32 a2,
+                              State &s, TJBox_AudioSample x)
+{
+  auto const y = b0 * x + s.fS1;
+  s.fS1 = b1 * x - a1 * y + s.fS2;
+  s.fS2 = b2 * x - a2 * y;
+  return y;
+}
+
+inline void process(BiquadCoefficients const &c, State &ioState, TJBox_AudioSample *ioDst, int iCount)
+{
+  auto s = ioState;
+  for(int i = 0; i < iCount; i++)
+    ioDst[i] = tick(c.fB0, c.fB1, c.fB2, c.fA1, c.fA2, s, ioDst[i]);
+  ioState = s;
+}
+
+// Both channels in the same loop: the recursion is latency bound (each sample depends on the previous one) so running
+// 2 independent chains side by side (which the compiler may also pack in 2 vector lanes) costs about the same as one.
+inline void process(BiquadCoefficients const &c, State &ioLeftState, State &ioRightState,
+                    TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight, int iCount)
+{
+  auto l = ioLeftState;
+  auto r = ioRightState;
+  for(int i = 0; i < iCount; i++)
+  {
+    ioLeft[i] = tick(c.fB0, c.fB1, c.fB2, c.fA1, c.fA2, l, ioLeft[i]);
+    ioRight[i] = tick(c.fB0, c.fB1, c.fB2, c.fA1, c.fA2, r, ioRight[i]);
+  }
+  ioLeftState = l;
+  ioRightState = r;
+}
+
+// Same as process while the coefficients move linearly from iFrom to iTo (reached on the last sample)
+inline void process(BiquadCoefficients const &iFrom, BiquadCoefficients const &iTo,
+                    State &ioLeftState, State &ioRightState,
+                    TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight, int iCount)
+{
+  auto const count = static_cast<TJBox_Float32>(iCount);
+  BiquadCoefficients const step{
+    (iTo.fB0 - iFrom.fB0) / count,
+    (iTo.fB1 - iFrom.fB1) / count,
+    (iTo.fB2 - iFrom.fB2) / count,
+    (iTo.fA1 - iFrom.fA1) / count,
+    (iTo.fA2 - iFrom.fA2) / count
+  };
+
+  auto l = ioLeftState;
+  auto r = ioRightState;
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const t = static_cast<TJBox_Float32>(i + 1);
+    auto const b0 = iFrom.fB0 + t * step.fB0;
+    auto const b1 = iFrom.fB1 + t * step.fB1;
+    auto const b2 = iFrom.fB2 + t * step.fB2;
+    auto const a1 = iFrom.fA1 + t * step.fA1;
+    auto const a2 = iFrom.fA2 + t * step.fA2;
+    ioLeft[i] = tick(b0, b1, b2, a1, a2, l, ioLeft[i]);
+    if(ioRight)
+      ioRight[i] = tick(b0, b1, b2, a1, a2, r, ioRight[i]);
+  }
+  ioLeftState = l;
+  ioRightState = r;
+}
+
+}
+
+/**
+ * Caches the last design so that calling `design` every batch with the same parameters (the common case) costs a
+ * comparison instead of trigonometric functions. */
+class BiquadDesigner
+{
+public:
+  inline BiquadCoefficients const &design(BiquadParameters const &iParams)
+  {
+    if(!fValid || iParams != fParams)
+    {
+      fParams = iParams;
+      fCoefficients = BiquadImpl::design(iParams);
+      fValid = true;
+    }
+    return fCoefficients;
+  }
+
+private:
+  BiquadParameters fParams{};
+  BiquadCoefficients fCoefficients{};
+  bool fValid{false};
+};
+
+/**
+ * Cascade of `stages` biquad filters (transposed direct form II, single precision) processing whole buffers, mono or
+ * stereo (each channel has its own state). Typical usage (every batch):
+ *
+ * ```
+ * fFilter.setStage(0, {EBiquadType::kLowPass, cutoff, q, 0, fClock.getSampleRate()});
+ * fFilter.process(buffer);
+ * ```
+ *
+ * When the coefficients of a stage change, they are interpolated linearly over the next processed batch (no zipper
+ * noise) and the design is only recomputed when the parameters change (see `BiquadDesigner`). A stage which has never
+ * been set is the identity and is skipped. The filter state is flushed of denormals after each call. */
+template<int stages = 1>
+class TBiquadCascade
+{
+  static_assert(stages > 0, "at least one stage");
+
+public:
+  /**
+   * Sets the (target) coefficients of a stage from the parameters */
+  void setStage(int iStage, BiquadParameters const &iParams)
+  {
+    setCoefficients(iStage, fStages[iStage].fDesigner.design(iParams));
+  }
+
+  /**
+   * Sets the (target) coefficients of a stage directly */
+  void setCoefficients(int iStage, BiquadCoefficients const &iCoefficients)
+  {
+    auto &stage = fStages[iStage];
+    stage.fTarget = iCoefficients;
+    if(!stage.fEnabled)
+    {
+      // first time: no ramp from the identity
+      stage.fCurrent = iCoefficients;
+      stage.fEnabled = true;
+    }
+  }
+
+  /**
+   * @return the coefficients in use (which differ from the ones set until the next batch is processed) */
+  inline BiquadCoefficients const &getCoefficients(int iStage) const { return fStages[iStage].fCurrent; }
+
+  /**
+   * Clears the state and jumps to the target coefficients (ex: on transport restart or when the sample rate changes) */
+  void reset()
+  {
+    for(auto &stage: fStages)
+    {
+      stage.fCurrent = stage.fTarget;
+      stage.fLeft = {};
+      stage.fRight = {};
+    }
+  }
+
+  /**
+   * Processes one channel in place (uses the left channel state) */
+  void process(TJBox_AudioSample *ioDst, int iCount)
+  {
+    process(ioDst, nullptr, iCount);
+  }
+
+  /**
+   * Processes both channels in place (in the same loop) */
+  void process(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight, int iCount)
+  {
+    if(iCount <= 0)
+      return;
+
+    for(auto &stage: fStages)
+    {
+      if(!stage.fEnabled)
+        continue;
+
+      if(stage.fCurrent != stage.fTarget)
+      {
+        BiquadImpl::process(stage.fCurrent, stage.fTarget, stage.fLeft, stage.fRight, ioLeft, ioRight, iCount);
+        stage.fCurrent = stage.fTarget;
+      }
+      else
+      {
+        if(ioRight)
+          BiquadImpl::process(stage.fCurrent, stage.fLeft, stage.fRight, ioLeft, ioRight, iCount);
+        else
+          BiquadImpl::process(stage.fCurrent, stage.fLeft, ioLeft, iCount);
+      }
+
+      stage.fLeft.flushDenormals();
+      stage.fRight.flushDenormals();
+    }
+  }
+
+  template<int size>
+  inline void process(TAudioBuffer<size> &ioBuffer)
+  {
+    process(ioBuffer.fAudioBuffer, size);
+  }
+
+  template<int size>
+  inline void process(TStereoAudioBuffer<size> &ioBuffer)
+  {
+    process(ioBuffer.fLeftAudioBuffer.fAudioBuffer, ioBuffer.fRightAudioBuffer.fAudioBuffer, size);
+  }
+
+private:
+  struct Stage
+  {
+    BiquadDesigner fDesigner{};
+    BiquadCoefficients fCurrent{};
+    BiquadCoefficients fTarget{};
+    BiquadImpl::State fLeft{};
+    BiquadImpl::State fRight{};
+    bool fEnabled{false};
+  };
+
+  Stage fStages[stages]{};
+};
+
+typedef TBiquadCascade<1> Biquad;
+
+#endif //__PongasoftCommon_Biquad_h__
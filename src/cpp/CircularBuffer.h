@@ -6,6 +6,11 @@
 #define PongasoftCommon_CIRCULARBUFFER_H
 
 #include "Jukebox.h"
+#include <algorithm>
+
+// only used by the writeBlock/readBlock convenience overloads (see AudioBuffer.h)
+template<int size>
+class TAudioBuffer;
 
 template <typename T>
 class CircularBuffer
@@ -71,6 +76,51 @@ public:
     return fold(0, endOffset, initValue, op);
   }
 
+  /**
+   * Same as calling `setAt(0, iSrc[i]); incrementHead();` for each element (so `getAt(-1)` is the last element
+   * written) but done in at most 2 contiguous copies (when `iCount > getSize()`, only the last `getSize()` elements
+   * are copied since the others would be overwritten) */
+  inline void writeBlock(T const *iSrc, int iCount)
+  {
+    JBOX_ASSERT(iCount >= 0);
+    if(iCount > fSize)
+    {
+      fStart = adjustIndex(fStart + iCount - fSize);
+      iSrc += iCount - fSize;
+      iCount = fSize;
+    }
+    auto const first = std::min(iCount, fSize - fStart);
+    std::copy(iSrc, iSrc + first, fBuf + fStart);
+    std::copy(iSrc + first, iSrc + iCount, fBuf);
+    fStart = adjustIndex(fStart + iCount);
+  }
+
+  /**
+   * Same as `oDst[i] = getAt(offset + i)` for `i` in `[0, iCount)` but done in at most 2 contiguous copies per
+   * `getSize()` elements. Ex: `readBlock(-delay, ...)` after `writeBlock` */
+  inline void readBlock(int offset, T *oDst, int iCount) const
+  {
+    JBOX_ASSERT(iCount >= 0);
+    auto const start = adjustIndexFromOffset(offset);
+    for(int done = 0; done < iCount; done += fSize)
+    {
+      auto const count = std::min(iCount - done, fSize);
+      auto const first = std::min(count, fSize - start);
+      std::copy(fBuf + start, fBuf + start + first, oDst + done);
+      std::copy(fBuf, fBuf + count - first, oDst + done + first);
+    }
+  }
+
+  /**
+   * Writes a whole batch (see `writeBlock`) */
+  template<int size>
+  inline void writeBlock(TAudioBuffer<size> const &iBuffer) { writeBlock(iBuffer.fAudioBuffer, size); }
+
+  /**
+   * Reads a whole batch (see `readBlock`) */
+  template<int size>
+  inline void readBlock(int offset, TAudioBuffer<size> &oBuffer) const { readBlock(offset, oBuffer.fAudioBuffer, size); }
+
 private:
   inline int adjustIndexFromOffset(int offset) const
   {
@@ -100,5 +150,94 @@ private:
   int fStart;
 };
 
+/**
+ * Same API as `CircularBuffer` but with the storage inline (no allocation, no pointer to follow) and a capacity
+ * which is a power of 2 so that wrapping an index (including negative offsets) is a single bitwise and instead of
+ * loops. Use it when the size is known at compile time (ex: the maximum delay of a device). */
+template <typename T, int N>
+class TStaticCircularBuffer
+{
+  static_assert(N > 0 && (N & (N - 1)) == 0, "N must be a power of 2");
+
+public:
+  TStaticCircularBuffer() = default;
+
+  // handle negative offsets as well
+  constexpr int getSize() const { return N; }
+  inline T getAt(int offset) const { return fBuf[adjustIndex(fStart + offset)]; }
+  inline void setAt(int offset, T e) { fBuf[adjustIndex(fStart + offset)] = e; }
+  inline void incrementHead() { fStart = adjustIndex(fStart + 1); }
+  inline void init(T initValue)
+  {
+    for(int i = 0; i < N; ++i)
+    {
+      fBuf[i] = initValue;
+    }
+  }
+
+  template<typename U, class BinaryPredicate>
+  inline U fold(int startOffset, int endOffset, U initValue, BinaryPredicate &op) const
+  {
+    U resultValue = initValue;
+
+    int const step = startOffset < endOffset ? 1 : -1;
+    int const adjEndOffset = adjustIndex(fStart + endOffset);
+
+    for(int i = adjustIndex(fStart + startOffset); i != adjEndOffset; i = adjustIndex(i + step))
+      resultValue = op(resultValue, fBuf[i]);
+
+    return resultValue;
+  }
+
+  template<typename U, class BinaryPredicate>
+  inline U fold(int endOffset, U initValue, BinaryPredicate &op) const
+  {
+    return fold(0, endOffset, initValue, op);
+  }
+
+  // see CircularBuffer::writeBlock
+  inline void writeBlock(T const *iSrc, int iCount)
+  {
+    JBOX_ASSERT(iCount >= 0);
+    if(iCount > N)
+    {
+      fStart = adjustIndex(fStart + iCount - N);
+      iSrc += iCount - N;
+      iCount = N;
+    }
+    auto const first = std::min(iCount, N - fStart);
+    std::copy(iSrc, iSrc + first, fBuf + fStart);
+    std::copy(iSrc + first, iSrc + iCount, fBuf);
+    fStart = adjustIndex(fStart + iCount);
+  }
+
+  // see CircularBuffer::readBlock
+  inline void readBlock(int offset, T *oDst, int iCount) const
+  {
+    JBOX_ASSERT(iCount >= 0);
+    auto const start = adjustIndex(fStart + offset);
+    for(int done = 0; done < iCount; done += N)
+    {
+      auto const count = std::min(iCount - done, N);
+      auto const first = std::min(count, N - start);
+      std::copy(fBuf + start, fBuf + start + first, oDst + done);
+      std::copy(fBuf, fBuf + count - first, oDst + done + first);
+    }
+  }
+
+  template<int size>
+  inline void writeBlock(TAudioBuffer<size> const &iBuffer) { writeBlock(iBuffer.fAudioBuffer, size); }
+
+  template<int size>
+  inline void readBlock(int offset, TAudioBuffer<size> &oBuffer) const { readBlock(offset, oBuffer.fAudioBuffer, size); }
+
+private:
+  // two's complement: -1 & (N - 1) == N - 1
+  static constexpr int adjustIndex(int index) { return index & (N - 1); }
+
+  T fBuf[N]{};
+  int fStart{0};
+};
+
 
 #endif //PongasoftCommon_CIRCULARBUFFER_H
@@ -30,6 +30,8 @@ const TJBox_Float64 MAX_CV_VALUE = 10000;
 
 constexpr auto MAX_TJbox_Float64 = std::numeric_limits<TJBox_Float64>::max();
 
+constexpr TJBox_Float64 kPi = 3.14159265358979323846;
+
 template <typename T>
 static constexpr T clamp(TJBox_Float64 value, int lower, int upper)
 {
@@ -0,0 +1,1189 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_DSPKernels_h__
+#define __PongasoftCommon_DSPKernels_h__
+
+#include "JukeboxTypes.h"
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+/**
+ * Selection of the vector instruction set (at compile time).
+ *
+ * - The Jukebox (Rack Extension) build does not allow intrinsics so it always uses the scalar code (which is written
+ *   so that the compiler has a chance to auto vectorize it)
+ * - A native build (`LOCAL_NATIVE_BUILD`) uses AVX2 when compiled with it enabled (ex: `-mavx2`), SSE2 on any other
+ *   x86-64 and NEON on arm64
+ * - Defining `RE_COMMON_DISABLE_SIMD` forces the scalar code in all cases
+ */
+#if LOCAL_NATIVE_BUILD && !defined(RE_COMMON_DISABLE_SIMD)
+#if defined(__AVX2__)
+#define RE_COMMON_SIMD_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#define RE_COMMON_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define RE_COMMON_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+#endif
+
+#if RE_COMMON_SIMD_AVX2 || RE_COMMON_SIMD_SSE2 || RE_COMMON_SIMD_NEON
+#define RE_COMMON_SIMD 1
+#else
+#define RE_COMMON_SIMD 0
+#endif
+
+/**
+ * The kernels in this namespace are the building blocks of `TAudioBuffer` and `TStereoAudioBuffer`: they operate on
+ * raw arrays of samples of any length (not necessarily a multiple of the vector width).
+ *
+ * - `dsp::scalar` contains the reference implementation
+ * - `dsp::simd` contains the vectorized implementation (only when `RE_COMMON_SIMD` is set)
+ * - `dsp` contains the entry points which delegate to one or the other
+ *
+ * All kernels produce exactly the same results (bit for bit) whether vectorized or not, unless specified otherwise,
+ * with one general exception: the vectorized code never uses fused multiply-add but the compiler may contract a
+ * multiplication followed by an addition in the scalar code (ex: `-mfma`, `-march=native`, arm64), so the kernels
+ * combining both (ramps, mixes, cross fades, polynomials...) may then differ in the last bit.
+ */
+namespace dsp {
+
+static_assert(std::is_same<TJBox_AudioSample, float>::value, "kernels assume that samples are single precision");
+
+// 20 * log10(2): dB = log2(linear) * kDbPerLog2
+constexpr TJBox_Float32 kDbPerLog2 = 6.02059991f;
+
+// log2(10) / 20: log2(linear) = dB * kLog2PerDb
+constexpr TJBox_Float32 kLog2PerDb = 0.166096404f;
+
+// log2(1 + t) ~= t * P(t) for t in [0, 1) (coefficients of P, lowest degree first; max error 1.2e-6)
+constexpr TJBox_Float32 kLog2Poly[] = { 1.44269298f, -0.721144092f, 0.477496364f, -0.338377198f, 0.213943212f,
+                                        -0.0946268097f, 0.02001665f };
+
+// 2^f ~= 1 + f * P(f) for f in [0, 1) (coefficients of P, lowest degree first; max relative error 6e-9)
+constexpr TJBox_Float32 kExp2Poly[] = { 0.693147171f, 0.240227204f, 0.0554960236f, 0.00965219506f, 0.00126921661f,
+                                        0.00020817915f };
+
+// tanh(x) ~= x * P(x^2) / Q(x^2) for |x| < kTanhClamp (rational minimax approximation, coefficients lowest degree
+// first). tanh(kTanhClamp) rounds to 1 in single precision so beyond it the result is set to exactly +/-1 (evaluating
+// the approximation there may land 1 ulp below 1, depending on fused multiply-add contraction).
+constexpr TJBox_Float32 kTanhNumerator[] = { 4.89352455891786e-03f, 6.37261928875436e-04f, 1.48572235717979e-05f,
+                                             5.12229709037114e-08f, -8.60467152213735e-11f, 2.00018790482477e-13f,
+                                             -2.76076847742355e-16f };
+constexpr TJBox_Float32 kTanhDenominator[] = { 4.89352518554385e-03f, 2.26843463243900e-03f, 1.18534705686654e-04f,
+                                               1.19825839466702e-06f };
+constexpr TJBox_Float32 kTanhClamp = 7.90531110763549805f;
+
+namespace scalar {
+
+inline void accumulate(TJBox_AudioSample *ioDst, TJBox_AudioSample const *iSrc, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+    ioDst[i] += iSrc[i];
+}
+
+inline void accumulate(TJBox_AudioSample *ioDst, TJBox_AudioSample const *iSrc, TJBox_Float32 iGain, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+    ioDst[i] += iSrc[i] * iGain;
+}
+
+inline void adjustGain(TJBox_AudioSample *ioDst, TJBox_Float32 iGain, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+    ioDst[i] *= iGain;
+}
+
+inline void multiply(TJBox_AudioSample *ioDst, TJBox_Float32 const *iGains, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+    ioDst[i] *= iGains[i];
+}
+
+inline void multiplyAdd(TJBox_Float32 *oDst, TJBox_Float32 const *iSrc, TJBox_Float32 iMul, TJBox_Float32 iAdd,
+                        int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+    oDst[i] = iSrc[i] * iMul + iAdd;
+}
+
+inline void rampGain(TJBox_AudioSample *ioDst, TJBox_Float32 iFromGain, TJBox_Float32 iStep, int iCount, int iStart = 0)
+{
+  for(int i = 0; i < iCount; i++)
+    ioDst[i] *= iFromGain + static_cast<TJBox_Float32>(iStart + i) * iStep;
+}
+
+inline void rampGain(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight,
+                     TJBox_Float32 iFromGain, TJBox_Float32 iStep, int iCount, int iStart = 0)
+{
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const gain = iFromGain + static_cast<TJBox_Float32>(iStart + i) * iStep;
+    ioLeft[i] *= gain;
+    ioRight[i] *= gain;
+  }
+}
+
+inline void adjustGain(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight,
+                       TJBox_Float32 iLeftGain, TJBox_Float32 iRightGain, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+  {
+    ioLeft[i] *= iLeftGain;
+    ioRight[i] *= iRightGain;
+  }
+}
+
+inline void rampGain(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight,
+                     TJBox_Float32 iFromLeftGain, TJBox_Float32 iLeftStep,
+                     TJBox_Float32 iFromRightGain, TJBox_Float32 iRightStep,
+                     int iCount, int iStart = 0)
+{
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const index = static_cast<TJBox_Float32>(iStart + i);
+    ioLeft[i] *= iFromLeftGain + index * iLeftStep;
+    ioRight[i] *= iFromRightGain + index * iRightStep;
+  }
+}
+
+inline void midSideEncode(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const left = ioLeft[i];
+    auto const right = ioRight[i];
+    ioLeft[i] = (left + right) * 0.5f;
+    ioRight[i] = (left - right) * 0.5f;
+  }
+}
+
+inline void midSideDecode(TJBox_AudioSample *ioMid, TJBox_AudioSample *ioSide, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const mid = ioMid[i];
+    auto const side = ioSide[i];
+    ioMid[i] = mid + side;
+    ioSide[i] = mid - side;
+  }
+}
+
+inline void stereoWidth(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight, TJBox_Float32 iWidth, int iCount)
+{
+  auto const sideGain = iWidth * 0.5f;
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const left = ioLeft[i];
+    auto const right = ioRight[i];
+    auto const mid = (left + right) * 0.5f;
+    auto const side = (left - right) * sideGain;
+    ioLeft[i] = mid + side;
+    ioRight[i] = mid - side;
+  }
+}
+
+inline void mix(TJBox_AudioSample *oDst, TJBox_AudioSample const * const *iSrcs, TJBox_Float32 const *iGains,
+                int iSourceCount, int iCount, int iStart = 0)
+{
+  for(int i = iStart; i < iStart + iCount; i++)
+  {
+    TJBox_AudioSample sample = 0;
+    for(int s = 0; s < iSourceCount; s++)
+      sample += iSrcs[s][i] * iGains[s];
+    oDst[i] = sample;
+  }
+}
+
+inline void xFade(TJBox_AudioSample *oDst, TJBox_AudioSample const *iSrc1, TJBox_AudioSample const *iSrc2,
+                  TJBox_Float32 const *iXFade, TJBox_Float32 const *iReverseXFade, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+    oDst[i] = iSrc1[i] * iXFade[i] + iSrc2[i] * iReverseXFade[i];
+}
+
+inline void xFade(TJBox_AudioSample *oLeft, TJBox_AudioSample *oRight,
+                  TJBox_AudioSample const *iLeft1, TJBox_AudioSample const *iRight1,
+                  TJBox_AudioSample const *iLeft2, TJBox_AudioSample const *iRight2,
+                  TJBox_Float32 const *iXFade, TJBox_Float32 const *iReverseXFade, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const xf = iXFade[i];
+    auto const rxf = iReverseXFade[i];
+    oLeft[i] = iLeft1[i] * xf + iLeft2[i] * rxf;
+    oRight[i] = iRight1[i] * xf + iRight2[i] * rxf;
+  }
+}
+
+inline void flushDenormals(TJBox_AudioSample *ioDst, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+    ioDst[i] = std::abs(ioDst[i]) < FLT_MIN ? 0 : ioDst[i];
+}
+
+inline TJBox_AudioSample max(TJBox_AudioSample const *iSrc, int iCount)
+{
+  TJBox_AudioSample res = 0;
+
+  for(int i = 0; i < iCount; i++)
+    res = std::max(res, std::abs(iSrc[i]));
+
+  return res;
+}
+
+inline void analyze(TJBox_AudioSample const *iSrc, int iCount,
+                    TJBox_AudioSample &ioPeak, TJBox_Float32 &ioSum, TJBox_Float32 &ioSumOfSquares)
+{
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const s = iSrc[i];
+    ioPeak = std::max(ioPeak, std::abs(s));
+    ioSum += s;
+    ioSumOfSquares += s * s;
+  }
+}
+
+inline void clamp(TJBox_Float32 const *iSrc, TJBox_Float32 *oDst, TJBox_Float32 iMin, TJBox_Float32 iMax, int iCount,
+                  TJBox_Float32 &ioLowest, TJBox_Float32 &ioHighest)
+{
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const v = std::min(std::max(iSrc[i], iMin), iMax);
+    oDst[i] = v;
+    ioLowest = std::min(ioLowest, v);
+    ioHighest = std::max(ioHighest, v);
+  }
+}
+
+inline TJBox_Float32 fastLog2(TJBox_Float32 x)
+{
+  // |x| = m * 2^e with m in [1, 2) => log2(|x|) = e + log2(m)
+  uint32_t bits;
+  std::memcpy(&bits, &x, sizeof(bits));
+  bits &= 0x7fffffff;
+  auto const e = static_cast<TJBox_Float32>(static_cast<int32_t>(bits >> 23) - 127);
+  bits = (bits & 0x007fffff) | 0x3f800000;
+  TJBox_Float32 m;
+  std::memcpy(&m, &bits, sizeof(m));
+
+  auto const t = m - 1.0f;
+  auto p = kLog2Poly[6];
+  for(int k = 5; k >= 0; k--)
+    p = p * t + kLog2Poly[k];
+  return e + t * p;
+}
+
+inline TJBox_Float32 fastExp2(TJBox_Float32 x)
+{
+  // x = n + f with n integer and f in [0, 1) => 2^x = 2^n * 2^f
+  x = std::min(std::max(x, -126.0f), 127.0f);
+  auto const n = std::floor(x);
+  auto const f = x - n;
+
+  auto p = kExp2Poly[5];
+  for(int k = 4; k >= 0; k--)
+    p = p * f + kExp2Poly[k];
+
+  auto const bits = static_cast<uint32_t>(static_cast<int32_t>(n) + 127) << 23;
+  TJBox_Float32 pow2n;
+  std::memcpy(&pow2n, &bits, sizeof(pow2n));
+  return (1.0f + f * p) * pow2n;
+}
+
+inline void linearToDb(TJBox_AudioSample const *iSrc, TJBox_Float32 *oDst, int iCount, TJBox_Float32 iMinDb)
+{
+  for(int i = 0; i < iCount; i++)
+    oDst[i] = std::max(fastLog2(iSrc[i]) * kDbPerLog2, iMinDb);
+}
+
+inline void dbToLinear(TJBox_Float32 const *iSrc, TJBox_Float32 *oDst, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+    oDst[i] = fastExp2(iSrc[i] * kLog2PerDb);
+}
+
+inline TJBox_Float32 fastTanh(TJBox_Float32 x)
+{
+  if(std::abs(x) >= kTanhClamp)
+    return x > 0 ? 1.0f : -1.0f;
+  auto const x2 = x * x;
+  auto p = kTanhNumerator[6];
+  for(int k = 5; k >= 0; k--)
+    p = p * x2 + kTanhNumerator[k];
+  auto q = kTanhDenominator[3];
+  for(int k = 2; k >= 0; k--)
+    q = q * x2 + kTanhDenominator[k];
+  return std::min(std::max(x * p / q, -1.0f), 1.0f);
+}
+
+inline void softClip(TJBox_AudioSample *ioDst, TJBox_Float32 iDrive, TJBox_Float32 iMix, int iCount)
+{
+  auto const dryGain = 1.0f - iMix;
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const dry = ioDst[i];
+    ioDst[i] = fastTanh(dry * iDrive) * iMix + dry * dryGain;
+  }
+}
+
+inline void hardClip(TJBox_AudioSample *ioDst, TJBox_Float32 iDrive, TJBox_Float32 iMix, int iCount)
+{
+  auto const dryGain = 1.0f - iMix;
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const dry = ioDst[i];
+    ioDst[i] = std::min(std::max(dry * iDrive, -1.0f), 1.0f) * iMix + dry * dryGain;
+  }
+}
+
+inline void asymmetricClip(TJBox_AudioSample *ioDst, TJBox_Float32 iDrive, TJBox_Float32 iBias, TJBox_Float32 iMix,
+                           int iCount)
+{
+  auto const offset = fastTanh(iBias);
+  auto const dryGain = 1.0f - iMix;
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const dry = ioDst[i];
+    ioDst[i] = (fastTanh(dry * iDrive + iBias) - offset) * iMix + dry * dryGain;
+  }
+}
+
+}
+
+#if RE_COMMON_SIMD
+namespace simd {
+
+//------------------------------------------------------------------------
+// Minimal abstraction of a vector of floats (`vfloat`) for each supported instruction set. Only what the kernels
+// need is implemented.
+//------------------------------------------------------------------------
+#if RE_COMMON_SIMD_AVX2
+using vfloat = __m256;
+constexpr int kWidth = 8;
+inline vfloat load(float const *p) { return _mm256_loadu_ps(p); }
+inline void store(float *p, vfloat v) { _mm256_storeu_ps(p, v); }
+inline vfloat set1(float f) { return _mm256_set1_ps(f); }
+inline vfloat iota() { return _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7); }
+inline vfloat add(vfloat a, vfloat b) { return _mm256_add_ps(a, b); }
+inline vfloat mul(vfloat a, vfloat b) { return _mm256_mul_ps(a, b); }
+inline vfloat sub(vfloat a, vfloat b) { return _mm256_sub_ps(a, b); }
+inline vfloat div(vfloat a, vfloat b) { return _mm256_div_ps(a, b); }
+// operands swapped so that max(a, b)/min(a, b) return `a` when unordered (NaN), like std::max(a, b)/std::min(a, b)
+inline vfloat max(vfloat a, vfloat b) { return _mm256_max_ps(b, a); }
+inline vfloat min(vfloat a, vfloat b) { return _mm256_min_ps(b, a); }
+inline vfloat floor(vfloat a) { return _mm256_floor_ps(a); }
+inline vfloat abs(vfloat a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+// for a >= 0: a = mantissa(a) * 2^exponent(a) with mantissa in [1, 2)
+inline vfloat exponent(vfloat a)
+{
+  return _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(_mm256_castps_si256(a), 23), _mm256_set1_epi32(127)));
+}
+inline vfloat mantissa(vfloat a)
+{
+  return _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(_mm256_castps_si256(a), _mm256_set1_epi32(0x007fffff)),
+                                             _mm256_set1_epi32(0x3f800000)));
+}
+// 2^n for n integer in [-126, 127]
+inline vfloat pow2i(vfloat n)
+{
+  return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23));
+}
+inline vfloat zeroIfAbsBelow(vfloat a, vfloat t) { return _mm256_and_ps(a, _mm256_cmp_ps(abs(a), t, _CMP_GE_OQ)); }
+inline float hmax(vfloat a)
+{
+  __m128 m = _mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+  m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+  m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+  return _mm_cvtss_f32(m);
+}
+inline float hsum(vfloat a)
+{
+  __m128 m = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+  m = _mm_add_ps(m, _mm_movehl_ps(m, m));
+  m = _mm_add_ss(m, _mm_shuffle_ps(m, m, 1));
+  return _mm_cvtss_f32(m);
+}
+#elif RE_COMMON_SIMD_SSE2
+using vfloat = __m128;
+constexpr int kWidth = 4;
+inline vfloat load(float const *p) { return _mm_loadu_ps(p); }
+inline void store(float *p, vfloat v) { _mm_storeu_ps(p, v); }
+inline vfloat set1(float f) { return _mm_set1_ps(f); }
+inline vfloat iota() { return _mm_setr_ps(0, 1, 2, 3); }
+inline vfloat add(vfloat a, vfloat b) { return _mm_add_ps(a, b); }
+inline vfloat mul(vfloat a, vfloat b) { return _mm_mul_ps(a, b); }
+inline vfloat sub(vfloat a, vfloat b) { return _mm_sub_ps(a, b); }
+inline vfloat div(vfloat a, vfloat b) { return _mm_div_ps(a, b); }
+// operands swapped so that max(a, b)/min(a, b) return `a` when unordered (NaN), like std::max(a, b)/std::min(a, b)
+inline vfloat max(vfloat a, vfloat b) { return _mm_max_ps(b, a); }
+inline vfloat min(vfloat a, vfloat b) { return _mm_min_ps(b, a); }
+// SSE2 has no floor: truncate then subtract 1 when the truncated value is above a (negative numbers)
+inline vfloat floor(vfloat a)
+{
+  auto const t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+  return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, a), _mm_set1_ps(1.0f)));
+}
+inline vfloat abs(vfloat a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+// for a >= 0: a = mantissa(a) * 2^exponent(a) with mantissa in [1, 2)
+inline vfloat exponent(vfloat a)
+{
+  return _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(a), 23), _mm_set1_epi32(127)));
+}
+inline vfloat mantissa(vfloat a)
+{
+  return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(_mm_castps_si128(a), _mm_set1_epi32(0x007fffff)),
+                                       _mm_set1_epi32(0x3f800000)));
+}
+// 2^n for n integer in [-126, 127]
+inline vfloat pow2i(vfloat n)
+{
+  return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23));
+}
+inline vfloat zeroIfAbsBelow(vfloat a, vfloat t) { return _mm_and_ps(a, _mm_cmpge_ps(abs(a), t)); }
+inline float hmax(vfloat a)
+{
+  __m128 m = _mm_max_ps(a, _mm_movehl_ps(a, a));
+  m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+  return _mm_cvtss_f32(m);
+}
+inline float hsum(vfloat a)
+{
+  __m128 m = _mm_add_ps(a, _mm_movehl_ps(a, a));
+  m = _mm_add_ss(m, _mm_shuffle_ps(m, m, 1));
+  return _mm_cvtss_f32(m);
+}
+#elif RE_COMMON_SIMD_NEON
+using vfloat = float32x4_t;
+constexpr int kWidth = 4;
+inline vfloat load(float const *p) { return vld1q_f32(p); }
+inline void store(float *p, vfloat v) { vst1q_f32(p, v); }
+inline vfloat set1(float f) { return vdupq_n_f32(f); }
+inline vfloat iota() { float const i[] = {0, 1, 2, 3}; return vld1q_f32(i); }
+inline vfloat add(vfloat a, vfloat b) { return vaddq_f32(a, b); }
+inline vfloat mul(vfloat a, vfloat b) { return vmulq_f32(a, b); }
+inline vfloat sub(vfloat a, vfloat b) { return vsubq_f32(a, b); }
+inline vfloat div(vfloat a, vfloat b) { return vdivq_f32(a, b); }
+// the "number" versions drop a NaN operand (vmaxq_f32 propagates it), like std::max(a, b) for a NaN `b`
+inline vfloat max(vfloat a, vfloat b) { return vmaxnmq_f32(a, b); }
+inline vfloat min(vfloat a, vfloat b) { return vminnmq_f32(a, b); }
+inline vfloat floor(vfloat a) { return vrndmq_f32(a); }
+inline vfloat abs(vfloat a) { return vabsq_f32(a); }
+// for a >= 0: a = mantissa(a) * 2^exponent(a) with mantissa in [1, 2)
+inline vfloat exponent(vfloat a)
+{
+  return vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_f32(a), 23)), vdupq_n_s32(127)));
+}
+inline vfloat mantissa(vfloat a)
+{
+  return vreinterpretq_f32_u32(vorrq_u32(vandq_u32(vreinterpretq_u32_f32(a), vdupq_n_u32(0x007fffff)),
+                                         vdupq_n_u32(0x3f800000)));
+}
+// 2^n for n integer in [-126, 127]
+inline vfloat pow2i(vfloat n)
+{
+  return vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127)), 23));
+}
+inline vfloat zeroIfAbsBelow(vfloat a, vfloat t)
+{
+  return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vcgeq_f32(vabsq_f32(a), t)));
+}
+inline float hmax(vfloat a) { return vmaxvq_f32(a); }
+inline float hsum(vfloat a) { return vaddvq_f32(a); }
+#endif
+
+/**
+ * @return the number of elements (out of `iCount`) which can be processed with full vectors (the remainder must be
+ *         processed by the scalar code) */
+constexpr int vectorCount(int iCount) { return iCount - (iCount % kWidth); }
+
+inline void accumulate(TJBox_AudioSample *ioDst, TJBox_AudioSample const *iSrc, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  for(int i = 0; i < n; i += kWidth)
+    store(ioDst + i, add(load(ioDst + i), load(iSrc + i)));
+  scalar::accumulate(ioDst + n, iSrc + n, iCount - n);
+}
+
+inline void accumulate(TJBox_AudioSample *ioDst, TJBox_AudioSample const *iSrc, TJBox_Float32 iGain, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const gain = set1(iGain);
+  for(int i = 0; i < n; i += kWidth)
+    store(ioDst + i, add(load(ioDst + i), mul(load(iSrc + i), gain)));
+  scalar::accumulate(ioDst + n, iSrc + n, iGain, iCount - n);
+}
+
+inline void adjustGain(TJBox_AudioSample *ioDst, TJBox_Float32 iGain, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const gain = set1(iGain);
+  for(int i = 0; i < n; i += kWidth)
+    store(ioDst + i, mul(load(ioDst + i), gain));
+  scalar::adjustGain(ioDst + n, iGain, iCount - n);
+}
+
+inline void multiply(TJBox_AudioSample *ioDst, TJBox_Float32 const *iGains, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  for(int i = 0; i < n; i += kWidth)
+    store(ioDst + i, mul(load(ioDst + i), load(iGains + i)));
+  scalar::multiply(ioDst + n, iGains + n, iCount - n);
+}
+
+inline void multiplyAdd(TJBox_Float32 *oDst, TJBox_Float32 const *iSrc, TJBox_Float32 iMul, TJBox_Float32 iAdd,
+                        int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const m = set1(iMul);
+  auto const a = set1(iAdd);
+  for(int i = 0; i < n; i += kWidth)
+    store(oDst + i, add(mul(load(iSrc + i), m), a));
+  scalar::multiplyAdd(oDst + n, iSrc + n, iMul, iAdd, iCount - n);
+}
+
+inline void rampGain(TJBox_AudioSample *ioDst, TJBox_Float32 iFromGain, TJBox_Float32 iStep, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const from = set1(iFromGain);
+  auto const step = set1(iStep);
+  auto const width = set1(kWidth);
+  auto index = iota();
+  for(int i = 0; i < n; i += kWidth)
+  {
+    store(ioDst + i, mul(load(ioDst + i), add(from, mul(index, step))));
+    index = add(index, width);
+  }
+  scalar::rampGain(ioDst + n, iFromGain, iStep, iCount - n, n);
+}
+
+inline void rampGain(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight,
+                     TJBox_Float32 iFromGain, TJBox_Float32 iStep, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const from = set1(iFromGain);
+  auto const step = set1(iStep);
+  auto const width = set1(kWidth);
+  auto index = iota();
+  for(int i = 0; i < n; i += kWidth)
+  {
+    auto const gain = add(from, mul(index, step));
+    store(ioLeft + i, mul(load(ioLeft + i), gain));
+    store(ioRight + i, mul(load(ioRight + i), gain));
+    index = add(index, width);
+  }
+  scalar::rampGain(ioLeft + n, ioRight + n, iFromGain, iStep, iCount - n, n);
+}
+
+inline void adjustGain(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight,
+                       TJBox_Float32 iLeftGain, TJBox_Float32 iRightGain, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const leftGain = set1(iLeftGain);
+  auto const rightGain = set1(iRightGain);
+  for(int i = 0; i < n; i += kWidth)
+  {
+    store(ioLeft + i, mul(load(ioLeft + i), leftGain));
+    store(ioRight + i, mul(load(ioRight + i), rightGain));
+  }
+  scalar::adjustGain(ioLeft + n, ioRight + n, iLeftGain, iRightGain, iCount - n);
+}
+
+inline void rampGain(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight,
+                     TJBox_Float32 iFromLeftGain, TJBox_Float32 iLeftStep,
+                     TJBox_Float32 iFromRightGain, TJBox_Float32 iRightStep,
+                     int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const fromLeft = set1(iFromLeftGain);
+  auto const leftStep = set1(iLeftStep);
+  auto const fromRight = set1(iFromRightGain);
+  auto const rightStep = set1(iRightStep);
+  auto const width = set1(kWidth);
+  auto index = iota();
+  for(int i = 0; i < n; i += kWidth)
+  {
+    store(ioLeft + i, mul(load(ioLeft + i), add(fromLeft, mul(index, leftStep))));
+    store(ioRight + i, mul(load(ioRight + i), add(fromRight, mul(index, rightStep))));
+    index = add(index, width);
+  }
+  scalar::rampGain(ioLeft + n, ioRight + n, iFromLeftGain, iLeftStep, iFromRightGain, iRightStep, iCount - n, n);
+}
+
+inline void midSideEncode(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const half = set1(0.5f);
+  for(int i = 0; i < n; i += kWidth)
+  {
+    auto const left = load(ioLeft + i);
+    auto const right = load(ioRight + i);
+    store(ioLeft + i, mul(add(left, right), half));
+    store(ioRight + i, mul(sub(left, right), half));
+  }
+  scalar::midSideEncode(ioLeft + n, ioRight + n, iCount - n);
+}
+
+inline void midSideDecode(TJBox_AudioSample *ioMid, TJBox_AudioSample *ioSide, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  for(int i = 0; i < n; i += kWidth)
+  {
+    auto const mid = load(ioMid + i);
+    auto const side = load(ioSide + i);
+    store(ioMid + i, add(mid, side));
+    store(ioSide + i, sub(mid, side));
+  }
+  scalar::midSideDecode(ioMid + n, ioSide + n, iCount - n);
+}
+
+inline void stereoWidth(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight, TJBox_Float32 iWidth, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const half = set1(0.5f);
+  auto const sideGain = set1(iWidth * 0.5f);
+  for(int i = 0; i < n; i += kWidth)
+  {
+    auto const left = load(ioLeft + i);
+    auto const right = load(ioRight + i);
+    auto const mid = mul(add(left, right), half);
+    auto const side = mul(sub(left, right), sideGain);
+    store(ioLeft + i, add(mid, side));
+    store(ioRight + i, sub(mid, side));
+  }
+  scalar::stereoWidth(ioLeft + n, ioRight + n, iWidth, iCount - n);
+}
+
+inline void mix(TJBox_AudioSample *oDst, TJBox_AudioSample const * const *iSrcs, TJBox_Float32 const *iGains,
+                int iSourceCount, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  for(int i = 0; i < n; i += kWidth)
+  {
+    auto sample = set1(0);
+    for(int s = 0; s < iSourceCount; s++)
+      sample = add(sample, mul(load(iSrcs[s] + i), set1(iGains[s])));
+    store(oDst + i, sample);
+  }
+  scalar::mix(oDst, iSrcs, iGains, iSourceCount, iCount - n, n);
+}
+
+inline void xFade(TJBox_AudioSample *oDst, TJBox_AudioSample const *iSrc1, TJBox_AudioSample const *iSrc2,
+                  TJBox_Float32 const *iXFade, TJBox_Float32 const *iReverseXFade, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  for(int i = 0; i < n; i += kWidth)
+    store(oDst + i, add(mul(load(iSrc1 + i), load(iXFade + i)), mul(load(iSrc2 + i), load(iReverseXFade + i))));
+  scalar::xFade(oDst + n, iSrc1 + n, iSrc2 + n, iXFade + n, iReverseXFade + n, iCount - n);
+}
+
+inline void xFade(TJBox_AudioSample *oLeft, TJBox_AudioSample *oRight,
+                  TJBox_AudioSample const *iLeft1, TJBox_AudioSample const *iRight1,
+                  TJBox_AudioSample const *iLeft2, TJBox_AudioSample const *iRight2,
+                  TJBox_Float32 const *iXFade, TJBox_Float32 const *iReverseXFade, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  for(int i = 0; i < n; i += kWidth)
+  {
+    auto const xf = load(iXFade + i);
+    auto const rxf = load(iReverseXFade + i);
+    store(oLeft + i, add(mul(load(iLeft1 + i), xf), mul(load(iLeft2 + i), rxf)));
+    store(oRight + i, add(mul(load(iRight1 + i), xf), mul(load(iRight2 + i), rxf)));
+  }
+  scalar::xFade(oLeft + n, oRight + n, iLeft1 + n, iRight1 + n, iLeft2 + n, iRight2 + n,
+                iXFade + n, iReverseXFade + n, iCount - n);
+}
+
+inline void flushDenormals(TJBox_AudioSample *ioDst, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const threshold = set1(FLT_MIN);
+  for(int i = 0; i < n; i += kWidth)
+    store(ioDst + i, zeroIfAbsBelow(load(ioDst + i), threshold));
+  scalar::flushDenormals(ioDst + n, iCount - n);
+}
+
+inline TJBox_AudioSample max(TJBox_AudioSample const *iSrc, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto res = set1(0);
+  for(int i = 0; i < n; i += kWidth)
+    res = max(res, abs(load(iSrc + i)));
+  return std::max(hmax(res), scalar::max(iSrc + n, iCount - n));
+}
+
+inline void analyze(TJBox_AudioSample const *iSrc, int iCount,
+                    TJBox_AudioSample &ioPeak, TJBox_Float32 &ioSum, TJBox_Float32 &ioSumOfSquares)
+{
+  auto const n = vectorCount(iCount);
+  auto peak = set1(0);
+  auto sum = set1(0);
+  auto sumOfSquares = set1(0);
+  for(int i = 0; i < n; i += kWidth)
+  {
+    auto const s = load(iSrc + i);
+    peak = max(peak, abs(s));
+    sum = add(sum, s);
+    sumOfSquares = add(sumOfSquares, mul(s, s));
+  }
+  ioPeak = std::max(ioPeak, hmax(peak));
+  ioSum += hsum(sum);
+  ioSumOfSquares += hsum(sumOfSquares);
+  scalar::analyze(iSrc + n, iCount - n, ioPeak, ioSum, ioSumOfSquares);
+}
+
+inline void clamp(TJBox_Float32 const *iSrc, TJBox_Float32 *oDst, TJBox_Float32 iMin, TJBox_Float32 iMax, int iCount,
+                  TJBox_Float32 &ioLowest, TJBox_Float32 &ioHighest)
+{
+  auto const n = vectorCount(iCount);
+  auto const lo = set1(iMin);
+  auto const hi = set1(iMax);
+  auto lowest = set1(ioLowest);
+  auto highest = set1(ioHighest);
+  for(int i = 0; i < n; i += kWidth)
+  {
+    auto const v = min(max(load(iSrc + i), lo), hi);
+    store(oDst + i, v);
+    lowest = min(lowest, v);
+    highest = max(highest, v);
+  }
+  // min(x) = -max(-x)
+  ioLowest = -hmax(sub(set1(0), lowest));
+  ioHighest = hmax(highest);
+  scalar::clamp(iSrc + n, oDst + n, iMin, iMax, iCount - n, ioLowest, ioHighest);
+}
+
+// same algorithm as scalar::fastLog2
+inline vfloat log2(vfloat x)
+{
+  x = abs(x);
+  auto const t = sub(mantissa(x), set1(1.0f));
+  auto p = set1(kLog2Poly[6]);
+  for(int k = 5; k >= 0; k--)
+    p = add(mul(p, t), set1(kLog2Poly[k]));
+  return add(exponent(x), mul(t, p));
+}
+
+// same algorithm as scalar::fastExp2
+inline vfloat exp2(vfloat x)
+{
+  x = min(max(x, set1(-126.0f)), set1(127.0f));
+  auto const n = floor(x);
+  auto const f = sub(x, n);
+  auto p = set1(kExp2Poly[5]);
+  for(int k = 4; k >= 0; k--)
+    p = add(mul(p, f), set1(kExp2Poly[k]));
+  return mul(add(set1(1.0f), mul(f, p)), pow2i(n));
+}
+
+inline void linearToDb(TJBox_AudioSample const *iSrc, TJBox_Float32 *oDst, int iCount, TJBox_Float32 iMinDb)
+{
+  auto const n = vectorCount(iCount);
+  auto const dbPerLog2 = set1(kDbPerLog2);
+  auto const minDb = set1(iMinDb);
+  for(int i = 0; i < n; i += kWidth)
+    store(oDst + i, max(mul(log2(load(iSrc + i)), dbPerLog2), minDb));
+  scalar::linearToDb(iSrc + n, oDst + n, iCount - n, iMinDb);
+}
+
+inline void dbToLinear(TJBox_Float32 const *iSrc, TJBox_Float32 *oDst, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const log2PerDb = set1(kLog2PerDb);
+  for(int i = 0; i < n; i += kWidth)
+    store(oDst + i, exp2(mul(load(iSrc + i), log2PerDb)));
+  scalar::dbToLinear(iSrc + n, oDst + n, iCount - n);
+}
+
+// same algorithm as scalar::fastTanh
+inline vfloat tanh(vfloat x)
+{
+  auto const one = set1(1.0f);
+  // +/-1 when |x| >= kTanhClamp, 0 otherwise
+  auto const saturated = min(max(zeroIfAbsBelow(x, set1(kTanhClamp)), set1(-1.0f)), one);
+  x = min(max(x, set1(-kTanhClamp)), set1(kTanhClamp));
+  auto const x2 = mul(x, x);
+  auto p = set1(kTanhNumerator[6]);
+  for(int k = 5; k >= 0; k--)
+    p = add(mul(p, x2), set1(kTanhNumerator[k]));
+  auto q = set1(kTanhDenominator[3]);
+  for(int k = 2; k >= 0; k--)
+    q = add(mul(q, x2), set1(kTanhDenominator[k]));
+  auto const res = min(max(div(mul(x, p), q), set1(-1.0f)), one);
+  // no select: saturated + (res - saturated) * 0 is exactly saturated (even when contracted)
+  return add(saturated, mul(sub(res, saturated), sub(one, abs(saturated))));
+}
+
+inline void softClip(TJBox_AudioSample *ioDst, TJBox_Float32 iDrive, TJBox_Float32 iMix, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const drive = set1(iDrive);
+  auto const mix = set1(iMix);
+  auto const dryGain = set1(1.0f - iMix);
+  for(int i = 0; i < n; i += kWidth)
+  {
+    auto const dry = load(ioDst + i);
+    store(ioDst + i, add(mul(tanh(mul(dry, drive)), mix), mul(dry, dryGain)));
+  }
+  scalar::softClip(ioDst + n, iDrive, iMix, iCount - n);
+}
+
+inline void hardClip(TJBox_AudioSample *ioDst, TJBox_Float32 iDrive, TJBox_Float32 iMix, int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const drive = set1(iDrive);
+  auto const mix = set1(iMix);
+  auto const dryGain = set1(1.0f - iMix);
+  auto const lo = set1(-1.0f);
+  auto const hi = set1(1.0f);
+  for(int i = 0; i < n; i += kWidth)
+  {
+    auto const dry = load(ioDst + i);
+    store(ioDst + i, add(mul(min(max(mul(dry, drive), lo), hi), mix), mul(dry, dryGain)));
+  }
+  scalar::hardClip(ioDst + n, iDrive, iMix, iCount - n);
+}
+
+inline void asymmetricClip(TJBox_AudioSample *ioDst, TJBox_Float32 iDrive, TJBox_Float32 iBias, TJBox_Float32 iMix,
+                           int iCount)
+{
+  auto const n = vectorCount(iCount);
+  auto const drive = set1(iDrive);
+  auto const bias = set1(iBias);
+  auto const offset = set1(scalar::fastTanh(iBias));
+  auto const mix = set1(iMix);
+  auto const dryGain = set1(1.0f - iMix);
+  for(int i = 0; i < n; i += kWidth)
+  {
+    auto const dry = load(ioDst + i);
+    store(ioDst + i, add(mul(sub(tanh(add(mul(dry, drive), bias)), offset), mix), mul(dry, dryGain)));
+  }
+  scalar::asymmetricClip(ioDst + n, iDrive, iBias, iMix, iCount - n);
+}
+
+}
+
+namespace impl = simd;
+#else
+namespace impl = scalar;
+#endif
+
+/**
+ * `ioDst[i] += iSrc[i]` */
+inline void accumulate(TJBox_AudioSample *ioDst, TJBox_AudioSample const *iSrc, int iCount)
+{
+  impl::accumulate(ioDst, iSrc, iCount);
+}
+
+/**
+ * `ioDst[i] += iSrc[i] * iGain` (one tap of a FIR filter, or one source of a mix) */
+inline void accumulate(TJBox_AudioSample *ioDst, TJBox_AudioSample const *iSrc, TJBox_Float32 iGain, int iCount)
+{
+  impl::accumulate(ioDst, iSrc, iGain, iCount);
+}
+
+/**
+ * `oDst[i] = iSrc[i]` (`memcpy` is already as fast as it gets) */
+inline void copy(TJBox_AudioSample *oDst, TJBox_AudioSample const *iSrc, int iCount)
+{
+  std::memcpy(oDst, iSrc, iCount * sizeof(TJBox_AudioSample));
+}
+
+/**
+ * `ioDst[i] *= iGain` */
+inline void adjustGain(TJBox_AudioSample *ioDst, TJBox_Float32 iGain, int iCount)
+{
+  impl::adjustGain(ioDst, iGain, iCount);
+}
+
+/**
+ * `ioDst[i] *= iGains[i]` (per sample gain, ex: filled by `TOnePoleSmoother::nextBatch`) */
+inline void multiply(TJBox_AudioSample *ioDst, TJBox_Float32 const *iGains, int iCount)
+{
+  impl::multiply(ioDst, iGains, iCount);
+}
+
+/**
+ * `oDst[i] = iSrc[i] * iMul + iAdd` (`oDst` may be `iSrc`) */
+inline void multiplyAdd(TJBox_Float32 *oDst, TJBox_Float32 const *iSrc, TJBox_Float32 iMul, TJBox_Float32 iAdd,
+                        int iCount)
+{
+  impl::multiplyAdd(oDst, iSrc, iMul, iAdd, iCount);
+}
+
+/**
+ * `ioDst[i] *= iFromGain + i * (iToGain - iFromGain) / iCount` (the gain reaches `iToGain` on the sample following the
+ * last one, so that consecutive ramps join without discontinuity). */
+inline void rampGain(TJBox_AudioSample *ioDst, TJBox_Float32 iFromGain, TJBox_Float32 iToGain, int iCount)
+{
+  if(iCount <= 0)
+    return;
+
+  if(iFromGain == iToGain)
+  {
+    adjustGain(ioDst, iFromGain, iCount);
+    return;
+  }
+
+  auto const step = (iToGain - iFromGain) / static_cast<TJBox_Float32>(iCount);
+
+  impl::rampGain(ioDst, iFromGain, step, iCount);
+}
+
+/**
+ * Same as `rampGain` but applies the same ramp to 2 channels in one pass */
+inline void rampGain(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight,
+                     TJBox_Float32 iFromGain, TJBox_Float32 iToGain, int iCount)
+{
+  if(iCount <= 0)
+    return;
+
+  if(iFromGain == iToGain)
+  {
+    adjustGain(ioLeft, iFromGain, iCount);
+    adjustGain(ioRight, iFromGain, iCount);
+    return;
+  }
+
+  auto const step = (iToGain - iFromGain) / static_cast<TJBox_Float32>(iCount);
+
+  impl::rampGain(ioLeft, ioRight, iFromGain, step, iCount);
+}
+
+/**
+ * `ioLeft[i] *= iLeftGain` and `ioRight[i] *= iRightGain` in one pass (ex: pan / balance) */
+inline void adjustGain(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight,
+                       TJBox_Float32 iLeftGain, TJBox_Float32 iRightGain, int iCount)
+{
+  impl::adjustGain(ioLeft, ioRight, iLeftGain, iRightGain, iCount);
+}
+
+/**
+ * Same as `rampGain` with a different ramp for each channel, in one pass (ex: pan / balance changing during the
+ * batch) */
+inline void rampGain(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight,
+                     TJBox_Float32 iFromLeftGain, TJBox_Float32 iToLeftGain,
+                     TJBox_Float32 iFromRightGain, TJBox_Float32 iToRightGain,
+                     int iCount)
+{
+  if(iCount <= 0)
+    return;
+
+  if(iFromLeftGain == iToLeftGain && iFromRightGain == iToRightGain)
+  {
+    adjustGain(ioLeft, ioRight, iFromLeftGain, iFromRightGain, iCount);
+    return;
+  }
+
+  auto const count = static_cast<TJBox_Float32>(iCount);
+  impl::rampGain(ioLeft, ioRight,
+                 iFromLeftGain, (iToLeftGain - iFromLeftGain) / count,
+                 iFromRightGain, (iToRightGain - iFromRightGain) / count,
+                 iCount);
+}
+
+/**
+ * Converts left/right into mid/side in place: `ioLeft[i] = (L + R) / 2` (mid) and `ioRight[i] = (L - R) / 2` (side).
+ * `midSideDecode` is the exact inverse (up to rounding). */
+inline void midSideEncode(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight, int iCount)
+{
+  impl::midSideEncode(ioLeft, ioRight, iCount);
+}
+
+/**
+ * Converts mid/side (as produced by `midSideEncode`) back into left/right in place: `ioMid[i] = M + S` (left) and
+ * `ioSide[i] = M - S` (right) */
+inline void midSideDecode(TJBox_AudioSample *ioMid, TJBox_AudioSample *ioSide, int iCount)
+{
+  impl::midSideDecode(ioMid, ioSide, iCount);
+}
+
+/**
+ * Scales the side signal by `iWidth` in place (encode, gain and decode fused in one pass): `0` collapses to mono,
+ * `1` leaves the signal unchanged (up to rounding) and `> 1` widens the stereo image. */
+inline void stereoWidth(TJBox_AudioSample *ioLeft, TJBox_AudioSample *ioRight, TJBox_Float32 iWidth, int iCount)
+{
+  impl::stereoWidth(ioLeft, ioRight, iWidth, iCount);
+}
+
+/**
+ * `oDst[i] = sum(iSrcs[s][i] * iGains[s])` for `s` in `[0, iSourceCount)`. The output is written once and each source
+ * is read once (the sum stays in registers), instead of the `2 * iSourceCount` read/write passes that calling
+ * `accumulate` and `adjustGain` per source requires.
+ *
+ * @note `oDst` may be one of the sources */
+inline void mix(TJBox_AudioSample *oDst, TJBox_AudioSample const * const *iSrcs, TJBox_Float32 const *iGains,
+                int iSourceCount, int iCount)
+{
+  impl::mix(oDst, iSrcs, iGains, iSourceCount, iCount);
+}
+
+/**
+ * `oDst[i] = iSrc1[i] * iXFade[i] + iSrc2[i] * iReverseXFade[i]` (`oDst` may be `iSrc1` or `iSrc2`) */
+inline void xFade(TJBox_AudioSample *oDst, TJBox_AudioSample const *iSrc1, TJBox_AudioSample const *iSrc2,
+                  TJBox_Float32 const *iXFade, TJBox_Float32 const *iReverseXFade, int iCount)
+{
+  impl::xFade(oDst, iSrc1, iSrc2, iXFade, iReverseXFade, iCount);
+}
+
+/**
+ * Same as `xFade` for 2 channels in one pass (the curves are loaded once for both channels) */
+inline void xFade(TJBox_AudioSample *oLeft, TJBox_AudioSample *oRight,
+                  TJBox_AudioSample const *iLeft1, TJBox_AudioSample const *iRight1,
+                  TJBox_AudioSample const *iLeft2, TJBox_AudioSample const *iRight2,
+                  TJBox_Float32 const *iXFade, TJBox_Float32 const *iReverseXFade, int iCount)
+{
+  impl::xFade(oLeft, oRight, iLeft1, iRight1, iLeft2, iRight2, iXFade, iReverseXFade, iCount);
+}
+
+/**
+ * Replaces denormals (`|ioDst[i]| < FLT_MIN`) by `0`. Contrary to `ScopedFlushDenormals` (see `Denormals.h`), this
+ * works in all builds (including the Jukebox one) */
+inline void flushDenormals(TJBox_AudioSample *ioDst, int iCount)
+{
+  impl::flushDenormals(ioDst, iCount);
+}
+
+/**
+ * @return `0` if `iValue` is a denormal, `iValue` otherwise (use it on filter/feedback state which decays
+ *         exponentially when the input goes silent) */
+template<typename T>
+constexpr T flushDenormal(T iValue)
+{
+  static_assert(std::is_floating_point<T>::value, "only for floating point values");
+  return (iValue < 0 ? -iValue : iValue) < std::numeric_limits<T>::min() ? 0 : iValue;
+}
+
+/**
+ * `oDst[i] = 0` */
+inline void clear(TJBox_AudioSample *oDst, int iCount)
+{
+  std::fill(oDst, oDst + iCount, 0);
+}
+
+/**
+ * @return `max(|iSrc[i]|)` (`0` when `iCount` is `0`) */
+inline TJBox_AudioSample max(TJBox_AudioSample const *iSrc, int iCount)
+{
+  return impl::max(iSrc, iCount);
+}
+
+/**
+ * Computes, in one pass, `max(|iSrc[i]|)`, `sum(iSrc[i])` and `sum(iSrc[i] * iSrc[i])`. The results are combined with
+ * the values already present in the output parameters (so that several buffers can be analyzed together).
+ *
+ * @note the vectorized version sums in a different order so the sums may differ in the last bits from the scalar
+ *       version (the peak is always exact) */
+inline void analyze(TJBox_AudioSample const *iSrc, int iCount,
+                    TJBox_AudioSample &ioPeak, TJBox_Float32 &ioSum, TJBox_Float32 &ioSumOfSquares)
+{
+  impl::analyze(iSrc, iCount, ioPeak, ioSum, ioSumOfSquares);
+}
+
+/**
+ * `oDst[i] = min(max(iSrc[i], iMin), iMax)` and computes, in the same pass, the lowest and highest values written
+ * (combined with the values already present in the output parameters). `iSrc` and `oDst` may be the same array. */
+inline void clamp(TJBox_Float32 const *iSrc, TJBox_Float32 *oDst, TJBox_Float32 iMin, TJBox_Float32 iMax, int iCount,
+                  TJBox_Float32 &ioLowest, TJBox_Float32 &ioHighest)
+{
+  impl::clamp(iSrc, oDst, iMin, iMax, iCount, ioLowest, ioHighest);
+}
+
+/**
+ * Fast approximation of `log2(|x|)`: max absolute error 1.2e-6 for `|x|` in `[0.5, 2]` and 6e-6 (4e-5 dB) for all
+ * normal numbers (float rounding of the result). `0` is mapped to `-127` (instead of `-inf`) and denormals to a value
+ * in `[-127, -126)`. */
+inline TJBox_Float32 fastLog2(TJBox_Float32 x)
+{
+  return scalar::fastLog2(x);
+}
+
+/**
+ * Fast approximation of `2^x`: max relative error 2e-7 (float precision). `x` is clamped to `[-126, 127]` so the
+ * result is always a normal (finite) number. */
+inline TJBox_Float32 fastExp2(TJBox_Float32 x)
+{
+  return scalar::fastExp2(x);
+}
+
+/**
+ * `oDst[i] = max(20 * log10(|iSrc[i]|), iMinDb)` using `fastLog2` (converts samples or peaks to dB). Silence (`0`)
+ * is clamped to `iMinDb` instead of `-inf` which requires `iMinDb >= -758` (the smallest normal float).
+ *
+ * @note `oDst` may be `iSrc` */
+inline void linearToDb(TJBox_AudioSample const *iSrc, TJBox_Float32 *oDst, int iCount, TJBox_Float32 iMinDb)
+{
+  impl::linearToDb(iSrc, oDst, iCount, iMinDb);
+}
+
+/**
+ * `oDst[i] = 10^(iSrc[i] / 20)` using `fastExp2` (inverse of `linearToDb`). Values below -758 dB (`-inf` included)
+ * produce the smallest normal float (~1e-38) instead of `0`.
+ *
+ * @note `oDst` may be `iSrc` */
+inline void dbToLinear(TJBox_Float32 const *iSrc, TJBox_Float32 *oDst, int iCount)
+{
+  impl::dbToLinear(iSrc, oDst, iCount);
+}
+
+/**
+ * Fast approximation of `tanh(x)` (rational approximation): max error 5e-7 (absolute and relative), odd and always in
+ * `[-1, 1]` (10x+ faster than `std::tanh`) */
+inline TJBox_Float32 fastTanh(TJBox_Float32 x)
+{
+  return scalar::fastTanh(x);
+}
+
+/**
+ * Soft clipping (saturation) in place: `ioDst[i] = mix(fastTanh(iDrive * ioDst[i]))` where `mix(wet)` is
+ * `wet * iMix + dry * (1 - iMix)` (`iMix = 1` is fully wet). The output is in `[-1, 1]` when fully wet. */
+inline void softClip(TJBox_AudioSample *ioDst, TJBox_Float32 iDrive, TJBox_Float32 iMix, int iCount)
+{
+  impl::softClip(ioDst, iDrive, iMix, iCount);
+}
+
+/**
+ * Hard clipping in place: `ioDst[i] = mix(clamp(iDrive * ioDst[i], -1, 1))` (see `softClip` for `mix`) */
+inline void hardClip(TJBox_AudioSample *ioDst, TJBox_Float32 iDrive, TJBox_Float32 iMix, int iCount)
+{
+  impl::hardClip(ioDst, iDrive, iMix, iCount);
+}
+
+/**
+ * Asymmetric saturation in place: `ioDst[i] = mix(fastTanh(iDrive * ioDst[i] + iBias) - fastTanh(iBias))` (see
+ * `softClip` for `mix`). Silence stays silent but the bias clips one polarity harder than the other which adds even
+ * harmonics (and some DC offset on loud signals). The fully wet output is in `[-1 - tanh(iBias), 1 - tanh(iBias)]`. */
+inline void asymmetricClip(TJBox_AudioSample *ioDst, TJBox_Float32 iDrive, TJBox_Float32 iBias, TJBox_Float32 iMix,
+                           int iCount)
+{
+  impl::asymmetricClip(ioDst, iDrive, iBias, iMix, iCount);
+}
+
+}
+
+#endif //__PongasoftCommon_DSPKernels_h__
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_DelayLine_h__
+#define __PongasoftCommon_DelayLine_h__
+
+#include "AudioBuffer.h"
+#include "CircularBuffer.h"
+#include <algorithm>
+#include <cmath>
+
+enum class EDelayInterpolation
+{
+  kLinear,  // cheapest, slight high frequency loss for fractional delays
+  kHermite, // 4 points cubic (Catmull-Rom): less high frequency loss, for fast modulation (pitch shift)
+  kAllPass  // flat magnitude response but stateful: only for slowly modulated delays (chorus, flanger)
+};
+
+namespace DelayLineImpl {
+
+/**
+ * The interpolation kernels read `iSrc` (a linear array, no wrapping) at the (fractional) positions `iPositions`
+ * (`x[i] + f` reads between `iSrc[i]` and `iSrc[i + 1]`). `iSrc` must contain 1 sample before and 2 samples after
+ * every position. */
+inline void linear(TJBox_AudioSample const *iSrc, TJBox_Float32 const *iPositions, TJBox_AudioSample *oDst, int iCount)
+{
+  for(int n = 0; n < iCount; n++)
+  {
+    auto const i = static_cast<int>(iPositions[n]);
+    auto const f = iPositions[n] - static_cast<TJBox_Float32>(i);
+    oDst[n] = iSrc[i] + f * (iSrc[i + 1] - iSrc[i]);
+  }
+}
+
+inline void hermite(TJBox_AudioSample const *iSrc, TJBox_Float32 const *iPositions, TJBox_AudioSample *oDst, int iCount)
+{
+  for(int n = 0; n < iCount; n++)
+  {
+    auto const i = static_cast<int>(iPositions[n]);
+    auto const f = iPositions[n] - static_cast<TJBox_Float32>(i);
+    auto const xm1 = iSrc[i - 1];
+    auto const x0 = iSrc[i];
+    auto const x1 = iSrc[i + 1];
+    auto const x2 = iSrc[i + 2];
+    auto const c1 = 0.5f * (x1 - xm1);
+    auto const c2 = xm1 - 2.5f * x0 + 2.0f * x1 - 0.5f * x2;
+    auto const c3 = 0.5f * (x2 - xm1) + 1.5f * (x0 - x1);
+    oDst[n] = ((c3 * f + c2) * f + c1) * f + x0;
+  }
+}
+
+// first order allpass (Thiran): `ioState` is the previous output. The fractional delay `D` (from the newest sample
+// of the pair) is kept in [0.5, 1.5) so that the pole (-eta) stays within [-1/3, 1/5] (a pole close to -1 rings at
+// Nyquist for many samples)
+inline void allPass(TJBox_AudioSample const *iSrc, TJBox_Float32 const *iPositions, TJBox_AudioSample *oDst, int iCount,
+                    TJBox_AudioSample &ioState)
+{
+  auto y = ioState;
+  for(int n = 0; n < iCount; n++)
+  {
+    auto const i = static_cast<int>(iPositions[n]);
+    auto const f = iPositions[n] - static_cast<TJBox_Float32>(i);
+
+    if(f <= 0.5f)
+    {
+      // D = 1 - f from iSrc[i + 1] => eta = (1 - D) / (1 + D)
+      auto const eta = f / (2.0f - f);
+      y = eta * (iSrc[i + 1] - y) + iSrc[i];
+    }
+    else
+    {
+      // D = 2 - f from iSrc[i + 2]
+      auto const eta = (f - 1.0f) / (3.0f - f);
+      y = eta * (iSrc[i + 2] - y) + iSrc[i + 1];
+    }
+    oDst[n] = y;
+  }
+  ioState = dsp::flushDenormal(y);
+}
+
+}
+
+/**
+ * Delay line (built on `TStaticCircularBuffer`, so `capacity` must be a power of 2) with fractional and per sample
+ * (modulated) delay times. Each batch is written then read:
+ *
+ * ```
+ * fDelayLine.write(fInput);
+ * fDelayLine.read(fDelays, fOutput.fAudioBuffer); // fDelays[i] = delay (in samples) for sample i
+ * ```
+ *
+ * A delay of `d` for sample `i` of the batch reads the input at time `i - d`. The delays are clamped to
+ * `[getMinDelay(), kMaxDelay]`: this is a feed forward delay line (for a feedback loop, the delay must be at least
+ * `size` so that the read happens before the write). The batch is read with one block copy out of the circular
+ * buffer (when the delays of the batch span less than `kWindowSize` samples, which covers modulation) and one call
+ * of the interpolation kernel.
+ */
+template<int capacity, int size = kBatchSize>
+class TDelayLine
+{
+public:
+  // the batch being read must still be in the buffer (with the interpolation neighbors)
+  static constexpr TJBox_Float32 kMaxDelay = capacity - size - 2;
+
+  // otherwise kMaxDelay is below getMinDelay() and the clamp is inverted
+  static_assert(capacity >= size + 4, "capacity too small for size (must be at least size + 4)");
+
+  // maximum span (in samples) of the positions read in one batch for the block path
+  static constexpr int kWindowSize = 4 * size;
+
+  explicit TDelayLine(EDelayInterpolation iInterpolation = EDelayInterpolation::kLinear) :
+    fInterpolation{iInterpolation}
+  {
+  }
+
+  void setInterpolation(EDelayInterpolation iInterpolation)
+  {
+    fInterpolation = iInterpolation;
+    fAllPassState = 0;
+  }
+
+  /**
+   * @return the minimum delay (the interpolation needs the samples after the read position to have been written) */
+  inline TJBox_Float32 getMinDelay() const { return fInterpolation == EDelayInterpolation::kHermite ? 2.0f : 1.0f; }
+
+  inline void write(TJBox_AudioSample const *iSamples) { fBuffer.writeBlock(iSamples, size); }
+  inline void write(TAudioBuffer<size> const &iBuffer) { fBuffer.writeBlock(iBuffer); }
+
+  /**
+   * Reads the batch (`size` samples) with a delay per sample (in samples, possibly fractional) */
+  void read(TJBox_Float32 const *iDelays, TJBox_AudioSample *oDst)
+  {
+    auto const minDelay = getMinDelay();
+    auto lowestDelay = kMaxDelay;
+    auto highestDelay = minDelay;
+    dsp::clamp(iDelays, fDelays, minDelay, kMaxDelay, size, lowestDelay, highestDelay);
+
+    // window (relative to the head of the circular buffer, the last sample written being at -1) covering all the
+    // read positions (`i - size - delay`) with 1 sample before and 2 samples after
+    auto const windowStart = static_cast<int>(std::floor(-static_cast<TJBox_Float32>(size) - highestDelay)) - 1;
+    auto const windowSize = static_cast<int>(std::floor(-1.0f - lowestDelay)) + 3 - windowStart;
+
+    if(windowSize <= kWindowSize)
+    {
+      fBuffer.readBlock(windowStart, fWindow, windowSize);
+      auto const offset = static_cast<TJBox_Float32>(-size - windowStart);
+      for(int i = 0; i < size; i++)
+        fPositions[i] = static_cast<TJBox_Float32>(i) + offset - fDelays[i];
+      interpolate(fWindow, fPositions, oDst, size);
+    }
+    else
+    {
+      // delays jumping around in the batch: one small window per sample
+      for(int i = 0; i < size; i++)
+      {
+        auto const position = static_cast<TJBox_Float32>(i - size) - fDelays[i];
+        auto const start = static_cast<int>(std::floor(position)) - 1;
+        fBuffer.readBlock(start, fWindow, 4);
+        auto const windowPosition = position - static_cast<TJBox_Float32>(start);
+        interpolate(fWindow, &windowPosition, oDst + i, 1);
+      }
+    }
+  }
+
+  /**
+   * Reads the batch (`size` samples) with the same delay for all samples */
+  void read(TJBox_Float32 iDelay, TJBox_AudioSample *oDst)
+  {
+    std::fill(std::begin(fDelays), std::end(fDelays), iDelay);
+    read(fDelays, oDst);
+  }
+
+  /**
+   * Writes the buffer and replaces it with the delayed signal */
+  inline void process(TAudioBuffer<size> &ioBuffer, TJBox_Float32 const *iDelays)
+  {
+    write(ioBuffer);
+    read(iDelays, ioBuffer.fAudioBuffer);
+  }
+
+  inline void process(TAudioBuffer<size> &ioBuffer, TJBox_Float32 iDelay)
+  {
+    write(ioBuffer);
+    read(iDelay, ioBuffer.fAudioBuffer);
+  }
+
+  /**
+   * Clears the delay line (silence) */
+  void reset()
+  {
+    fBuffer.init(0);
+    fAllPassState = 0;
+  }
+
+private:
+  inline void interpolate(TJBox_AudioSample const *iSrc, TJBox_Float32 const *iPositions, TJBox_AudioSample *oDst,
+                          int iCount)
+  {
+    switch(fInterpolation)
+    {
+      case EDelayInterpolation::kHermite:
+        DelayLineImpl::hermite(iSrc, iPositions, oDst, iCount);
+        break;
+
+      case EDelayInterpolation::kAllPass:
+        DelayLineImpl::allPass(iSrc, iPositions, oDst, iCount, fAllPassState);
+        break;
+
+      default:
+        DelayLineImpl::linear(iSrc, iPositions, oDst, iCount);
+        break;
+    }
+  }
+
+private:
+  EDelayInterpolation fInterpolation;
+  TStaticCircularBuffer<TJBox_AudioSample, capacity> fBuffer{};
+  TJBox_AudioSample fAllPassState{};
+  TJBox_Float32 fPositions[size]{};
+  TJBox_Float32 fDelays[size]{};
+  TJBox_AudioSample fWindow[kWindowSize]{};
+};
+
+#endif //__PongasoftCommon_DelayLine_h__
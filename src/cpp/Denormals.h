@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_Denormals_h__
+#define __PongasoftCommon_Denormals_h__
+
+#include "DSPKernels.h"
+
+// independent of RE_COMMON_SIMD: disabling the vectorized kernels should not change the floating point mode
+#if LOCAL_NATIVE_BUILD && (defined(__SSE__) || defined(_M_X64))
+#define RE_COMMON_DENORMALS_MXCSR 1
+#include <xmmintrin.h>
+#elif LOCAL_NATIVE_BUILD && defined(__aarch64__) && defined(__GNUC__)
+#define RE_COMMON_DENORMALS_FPCR 1
+#endif
+
+#include <cstdint>
+
+namespace dsp {
+
+/**
+ * Sets the CPU in "flush to zero" / "denormals are zero" mode for the duration of the scope, so that values decaying
+ * into the denormal range (feedback loops, filters, reverb tails...) do not cause massive CPU spikes. The previous
+ * mode is restored when the object goes out of scope.
+ *
+ * ```
+ * void renderBatch(...)
+ * {
+ *   dsp::ScopedFlushDenormals flushDenormals{};
+ *   // ... render code
+ * }
+ * ```
+ *
+ * This is only available in native builds (x86 and arm64): in the Jukebox build it does nothing, so use the portable
+ * `dsp::flushDenormals` / `dsp::flushDenormal` on the state that can decay. Note that `JBox_Export_RenderRealtime`
+ * (`JukeboxExports.cpp`) already wraps `CommonDevice::renderBatch` with it.
+ */
+class ScopedFlushDenormals
+{
+public:
+#if RE_COMMON_DENORMALS_MXCSR
+  // MXCSR: FTZ (bit 15) | DAZ (bit 6)
+  ScopedFlushDenormals() : fPreviousState{_mm_getcsr()} { _mm_setcsr(fPreviousState | 0x8040); }
+  ~ScopedFlushDenormals() { _mm_setcsr(fPreviousState); }
+#elif RE_COMMON_DENORMALS_FPCR
+  // FPCR: FZ (bit 24)
+  ScopedFlushDenormals() : fPreviousState{getFPCR()} { setFPCR(fPreviousState | (static_cast<uint64_t>(1) << 24)); }
+  ~ScopedFlushDenormals() { setFPCR(fPreviousState); }
+#else
+  ScopedFlushDenormals() = default;
+#endif
+
+  ScopedFlushDenormals(ScopedFlushDenormals const &) = delete;
+  ScopedFlushDenormals &operator=(ScopedFlushDenormals const &) = delete;
+
+private:
+#if RE_COMMON_DENORMALS_MXCSR
+  unsigned int fPreviousState;
+#elif RE_COMMON_DENORMALS_FPCR
+  static uint64_t getFPCR()
+  {
+    uint64_t fpcr;
+    asm volatile("mrs %0, fpcr" : "=r"(fpcr));
+    return fpcr;
+  }
+
+  static void setFPCR(uint64_t iFPCR) { asm volatile("msr fpcr, %0" : : "r"(iFPCR)); }
+
+  uint64_t fPreviousState;
+#endif
+};
+
+}
+
+#endif //__PongasoftCommon_Denormals_h__
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_Dynamics_h__
+#define __PongasoftCommon_Dynamics_h__
+
+#include "AudioBuffer.h"
+#include "DSPKernels.h"
+#include "SampleRateBasedClock.h"
+#include <algorithm>
+#include <cmath>
+
+enum class EDynamicsMode
+{
+  kCompressor, // reduces the gain above the threshold (compressor, limiter, ducker)
+  kExpander    // reduces the gain below the threshold (expander, gate)
+};
+
+enum class EDynamicsDetector
+{
+  kPeak,
+  kRms
+};
+
+/**
+ * Configuration of `TDynamics` (levels in dB, times in milliseconds) */
+struct DynamicsParameters
+{
+  EDynamicsMode fMode{EDynamicsMode::kCompressor};
+  EDynamicsDetector fDetector{EDynamicsDetector::kPeak};
+
+  TJBox_Float32 fThresholdDb{-20};
+
+  // compressor: 1dB out for every `fRatio` dB in above the threshold (use a large value for a limiter)
+  // expander: `fRatio` dB out for every 1dB in below the threshold (use a large value for a gate)
+  TJBox_Float32 fRatio{4};
+
+  // width of the (quadratic) transition around the threshold (0 = hard knee)
+  TJBox_Float32 fKneeDb{6};
+
+  // maximum gain reduction (ex: how much a gate attenuates when closed)
+  TJBox_Float32 fRangeDb{120};
+
+  TJBox_Float32 fMakeupDb{0};
+
+  // time constant when the gain reduction increases / decreases
+  TJBox_Float64 fAttackMs{10};
+  TJBox_Float64 fReleaseMs{100};
+
+  // integration time of the RMS detector
+  TJBox_Float64 fRmsWindowMs{10};
+};
+
+/**
+ * Envelope follower and gain computer shared by compressors, limiters, expanders, gates and duckers: it consumes a
+ * sidechain buffer (which can be the input itself) and produces the gain to apply to each sample of the batch. The
+ * pipeline is done in the log domain (with `dsp::linearToDb`/`dsp::dbToLinear`):
+ *
+ * 1. level detection (peak or RMS) and conversion to dB
+ * 2. gain computer (threshold, ratio and soft knee) => gain reduction in dB
+ * 3. attack/release smoothing of the gain reduction (so the attack/release times do not depend on the ratio)
+ * 4. conversion to linear gains (with makeup gain)
+ *
+ * ```
+ * // setup
+ * Dynamics fCompressor{clock, DynamicsParameters{}};
+ *
+ * // renderBatch
+ * fCompressor.process(fSidechain, fGains);
+ * fOutput.applyGains(fGains);
+ * ```
+ */
+template<int size = kBatchSize>
+class TDynamics
+{
+public:
+  TDynamics(Utils::SampleRateBasedClock const &iClock, DynamicsParameters const &iParameters) :
+    fParameters{iParameters}
+  {
+    setSampleRate(iClock);
+  }
+
+  /**
+   * Recomputes the coefficients (must be called when the sample rate changes) */
+  void setSampleRate(Utils::SampleRateBasedClock const &iClock)
+  {
+    fSampleRate = static_cast<TJBox_Float64>(iClock.getSampleRate());
+    computeCoefficients();
+  }
+
+  void setParameters(DynamicsParameters const &iParameters)
+  {
+    fParameters = iParameters;
+    computeCoefficients();
+  }
+
+  inline DynamicsParameters const &getParameters() const { return fParameters; }
+
+  /**
+   * Computes the gains (`size` values in `oGains`) for a mono sidechain */
+  void process(TAudioBuffer<size> const &iSidechain, TJBox_Float32 *oGains)
+  {
+    auto const *samples = iSidechain.fAudioBuffer;
+
+    if(fParameters.fDetector == EDynamicsDetector::kPeak)
+      dsp::copy(fLevels, samples, size);
+    else
+    {
+      for(int i = 0; i < size; i++)
+        fLevels[i] = samples[i] * samples[i];
+    }
+
+    computeGains(oGains);
+  }
+
+  /**
+   * Computes the gains (`size` values in `oGains`) for a stereo sidechain (linked: both channels get the same gain)
+   * using the max of both channels (peak) or the average of their squares (RMS) */
+  void process(TStereoAudioBuffer<size> const &iSidechain, TJBox_Float32 *oGains)
+  {
+    auto const *left = iSidechain.fLeftAudioBuffer.fAudioBuffer;
+    auto const *right = iSidechain.fRightAudioBuffer.fAudioBuffer;
+
+    if(fParameters.fDetector == EDynamicsDetector::kPeak)
+    {
+      for(int i = 0; i < size; i++)
+        fLevels[i] = std::max(std::abs(left[i]), std::abs(right[i]));
+    }
+    else
+    {
+      for(int i = 0; i < size; i++)
+        fLevels[i] = (left[i] * left[i] + right[i] * right[i]) * 0.5f;
+    }
+
+    computeGains(oGains);
+  }
+
+  /**
+   * Clears the state (no gain reduction) */
+  void reset()
+  {
+    fMeanSquare = 0;
+    fGainReductionDb = 0;
+  }
+
+  /**
+   * @return the current gain reduction in dB (`<= 0`, for metering) */
+  inline TJBox_Float32 getGainReductionDb() const { return fGainReductionDb; }
+
+  /**
+   * Static curve: gain reduction in dB (`<= 0`) for a given level in dB */
+  static TJBox_Float32 computeGainReductionDb(DynamicsParameters const &iParameters, TJBox_Float32 iLevelDb)
+  {
+    auto const overshoot = iLevelDb - iParameters.fThresholdDb;
+    auto const knee = iParameters.fKneeDb;
+    auto const halfKnee = knee * 0.5f;
+    TJBox_Float32 res;
+
+    if(iParameters.fMode == EDynamicsMode::kCompressor)
+    {
+      auto const slope = 1.0f / std::max(iParameters.fRatio, 1.0f) - 1.0f;
+      if(overshoot <= -halfKnee)
+        res = 0;
+      else if(overshoot < halfKnee)
+      {
+        auto const x = overshoot + halfKnee;
+        res = slope * x * x / (2.0f * knee);
+      }
+      else
+        res = slope * overshoot;
+    }
+    else
+    {
+      auto const slope = std::max(iParameters.fRatio, 1.0f) - 1.0f;
+      if(overshoot >= halfKnee)
+        res = 0;
+      else if(overshoot > -halfKnee)
+      {
+        auto const x = overshoot - halfKnee;
+        res = -slope * x * x / (2.0f * knee);
+      }
+      else
+        res = slope * overshoot;
+    }
+
+    return std::max(res, -iParameters.fRangeDb);
+  }
+
+public:
+  // level of silence (in dB)
+  static constexpr TJBox_Float32 kMinDb = -120.0f;
+
+private:
+  // per sample one pole coefficient: the distance to the target is divided by e every iMs
+  TJBox_Float32 computeCoefficient(TJBox_Float64 iMs) const
+  {
+    if(iMs <= 0)
+      return 0;
+    return static_cast<TJBox_Float32>(std::exp(-1.0 / (iMs * fSampleRate / 1000.0)));
+  }
+
+  void computeCoefficients()
+  {
+    fAttackCoefficient = computeCoefficient(fParameters.fAttackMs);
+    fReleaseCoefficient = computeCoefficient(fParameters.fReleaseMs);
+    fRmsCoefficient = computeCoefficient(fParameters.fRmsWindowMs);
+  }
+
+  // fLevels contains |samples| (peak) or squares (rms)
+  void computeGains(TJBox_Float32 *oGains)
+  {
+    // 1. level in dB
+    if(fParameters.fDetector == EDynamicsDetector::kRms)
+    {
+      auto ms = fMeanSquare;
+      for(int i = 0; i < size; i++)
+      {
+        ms = fLevels[i] + fRmsCoefficient * (ms - fLevels[i]);
+        fLevels[i] = ms;
+      }
+      fMeanSquare = dsp::flushDenormal(ms);
+
+      // 10 * log10(ms) = 20 * log10(ms) / 2
+      dsp::linearToDb(fLevels, fLevels, size, 2.0f * kMinDb);
+      dsp::adjustGain(fLevels, 0.5f, size);
+    }
+    else
+      dsp::linearToDb(fLevels, fLevels, size, kMinDb);
+
+    // 2. gain computer + 3. smoothing (attack when the reduction increases)
+    auto gr = fGainReductionDb;
+    for(int i = 0; i < size; i++)
+    {
+      auto const target = computeGainReductionDb(fParameters, fLevels[i]);
+      auto const coefficient = target < gr ? fAttackCoefficient : fReleaseCoefficient;
+      gr = target + coefficient * (gr - target);
+      oGains[i] = gr + fParameters.fMakeupDb;
+    }
+    fGainReductionDb = dsp::flushDenormal(gr);
+
+    // 4. linear gains
+    dsp::dbToLinear(oGains, oGains, size);
+  }
+
+private:
+  DynamicsParameters fParameters;
+  TJBox_Float64 fSampleRate{};
+
+  TJBox_Float32 fAttackCoefficient{};
+  TJBox_Float32 fReleaseCoefficient{};
+  TJBox_Float32 fRmsCoefficient{};
+
+  TJBox_Float32 fMeanSquare{};
+  TJBox_Float32 fGainReductionDb{};
+  TJBox_Float32 fLevels[size]{};
+};
+
+typedef TDynamics<kBatchSize> Dynamics;
+
+#endif //__PongasoftCommon_Dynamics_h__
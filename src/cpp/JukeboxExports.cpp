@@ -2,6 +2,7 @@
 #include <cstring>
 #include "CommonDevice.h"
 #include "JukeboxExports.h"
+#include "Denormals.h"
 
 /**
 * Note from forum: https://www.propellerheads.se/forum/showpost.php?p=1585993&postcount=15
@@ -41,6 +42,9 @@ void JBox_Export_RenderRealtime(void *privateState, const TJBox_PropertyDiff iPr
   }
   //JBOX_ASSERT(privateState != NULL);
 
+  // native build only (no op in the Jukebox build)
+  dsp::ScopedFlushDenormals flushDenormals{};
+
   CommonDevice *pi = reinterpret_cast<CommonDevice *>(privateState);
   pi->renderBatch(iPropertyDiffs, iDiffCount);
 }
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_Meter_h__
+#define __PongasoftCommon_Meter_h__
+
+#include "AudioBuffer.h"
+#include "SampleRateBasedClock.h"
+#include <cmath>
+
+/**
+ * Configuration of a `Meter` (all times in milliseconds) */
+struct MeterBallistics
+{
+  // time constant when the level goes up (0 = instant, which is what a peak meter does)
+  TJBox_Float64 fAttackMs{0};
+
+  // time constant when the level goes down
+  TJBox_Float64 fReleaseMs{300};
+
+  // how long the peak hold stays at the highest peak before following the level again (0 = no hold)
+  TJBox_Float64 fPeakHoldMs{1500};
+
+  // integration time of the (exponentially weighted) RMS level (300ms for VU ballistics)
+  TJBox_Float64 fRmsWindowMs{300};
+
+  // a batch with a peak at or above this threshold counts as a clip
+  TJBox_AudioSample fClipThreshold{1.0f};
+};
+
+/**
+ * Reusable meter fed once per batch (at audio rate) with the stats computed by `TAudioBuffer::analyze` (so the
+ * samples are read only once) which maintains:
+ *
+ * - a peak level with attack/release ballistics
+ * - a peak hold
+ * - an RMS level
+ * - the number of clips
+ *
+ * The values are meant to be published at UI rate with a `MeterPublisher`:
+ *
+ * ```
+ * // setup
+ * Meter fMeter{clock, MeterBallistics{}};
+ * MeterPublisher fMeterPublisher{clock.getRateLimiter(40)}; // 25 times a second
+ *
+ * // renderBatch
+ * fMeter.process(fBuffer.analyze());
+ * if(fMeterPublisher.shouldPublish(kBatchSize))
+ *   fMeterPublisher.publish(fPeakDbProperty, fMeter.getPeakDb(), 0.1f);
+ * ```
+ */
+class Meter
+{
+public:
+  Meter(Utils::SampleRateBasedClock const &iClock, MeterBallistics const &iBallistics, int iBatchSize = kBatchSize) :
+    fBallistics{iBallistics}, fBatchSize{iBatchSize}
+  {
+    setSampleRate(iClock);
+  }
+
+  /**
+   * Recomputes the coefficients (must be called when the sample rate changes) */
+  void setSampleRate(Utils::SampleRateBasedClock const &iClock)
+  {
+    auto const sampleRate = static_cast<TJBox_Float64>(iClock.getSampleRate());
+    fAttackCoefficient = computeCoefficient(fBallistics.fAttackMs, sampleRate);
+    fReleaseCoefficient = computeCoefficient(fBallistics.fReleaseMs, sampleRate);
+    fRmsCoefficient = computeCoefficient(fBallistics.fRmsWindowMs, sampleRate);
+    fPeakHoldInSamples = static_cast<int>(iClock.getSampleCountFor(fBallistics.fPeakHoldMs));
+  }
+
+  /**
+   * Processes the stats of one batch (`iStats.fCount` may be larger than the batch size when several channels are
+   * analyzed together) */
+  void process(AudioBufferStats const &iStats)
+  {
+    auto const peak = iStats.fPeak;
+
+    // peak level with ballistics
+    auto const coefficient = peak > fPeak ? fAttackCoefficient : fReleaseCoefficient;
+    fPeak = dsp::flushDenormal(peak + coefficient * (fPeak - peak));
+
+    // peak hold
+    if(peak >= fPeakHold)
+    {
+      fPeakHold = peak;
+      fPeakHoldCounter = fPeakHoldInSamples;
+    }
+    else
+    {
+      // stops at 0 (no overflow with continuous audio)
+      if(fPeakHoldCounter > 0)
+        fPeakHoldCounter -= fBatchSize;
+      if(fPeakHoldCounter <= 0)
+        fPeakHold = fPeak;
+    }
+
+    // rms
+    auto const meanSquare = iStats.fCount > 0 ? iStats.fSumOfSquares / iStats.fCount : 0;
+    fMeanSquare = dsp::flushDenormal(meanSquare + fRmsCoefficient * (fMeanSquare - meanSquare));
+
+    // clips
+    if(peak >= fBallistics.fClipThreshold)
+      fClipCount++;
+  }
+
+  /**
+   * Resets all levels (but not the clip count, see `resetClipCount`) */
+  void reset()
+  {
+    fPeak = 0;
+    fPeakHold = 0;
+    fPeakHoldCounter = 0;
+    fMeanSquare = 0;
+  }
+
+  inline TJBox_AudioSample getPeak() const { return fPeak; }
+  inline TJBox_AudioSample getPeakHold() const { return fPeakHold; }
+  inline TJBox_AudioSample getRms() const { return std::sqrt(fMeanSquare); }
+
+  inline TJBox_Float32 getPeakDb(TJBox_Float32 iMinDb = kMinDb) const { return toDb(fPeak, iMinDb); }
+  inline TJBox_Float32 getPeakHoldDb(TJBox_Float32 iMinDb = kMinDb) const { return toDb(fPeakHold, iMinDb); }
+
+  // 20 * log10(sqrt(ms)) = 10 * log10(ms)
+  inline TJBox_Float32 getRmsDb(TJBox_Float32 iMinDb = kMinDb) const
+  {
+    return std::max(dsp::fastLog2(fMeanSquare) * (dsp::kDbPerLog2 / 2), iMinDb);
+  }
+
+  inline int getClipCount() const { return fClipCount; }
+  inline void resetClipCount() { fClipCount = 0; }
+
+public:
+  // value returned by the dB getters for silence
+  static constexpr TJBox_Float32 kMinDb = -120.0f;
+
+private:
+  // one pole coefficient applied once per batch: the distance to the target is divided by e every iMs
+  TJBox_Float32 computeCoefficient(TJBox_Float64 iMs, TJBox_Float64 iSampleRate) const
+  {
+    if(iMs <= 0)
+      return 0;
+    return static_cast<TJBox_Float32>(std::exp(-fBatchSize / (iMs * iSampleRate / 1000.0)));
+  }
+
+  static inline TJBox_Float32 toDb(TJBox_AudioSample iValue, TJBox_Float32 iMinDb)
+  {
+    return std::max(dsp::fastLog2(iValue) * dsp::kDbPerLog2, iMinDb);
+  }
+
+private:
+  MeterBallistics fBallistics;
+  int fBatchSize;
+
+  TJBox_Float32 fAttackCoefficient{};
+  TJBox_Float32 fReleaseCoefficient{};
+  TJBox_Float32 fRmsCoefficient{};
+  int fPeakHoldInSamples{};
+
+  TJBox_AudioSample fPeak{};
+  TJBox_AudioSample fPeakHold{};
+  int fPeakHoldCounter{};
+  TJBox_Float32 fMeanSquare{};
+  int fClipCount{};
+};
+
+/**
+ * Publishes values (ex: meter levels) to output properties at UI rate: `shouldPublish` must be called every batch and
+ * returns `true` when the rate limiter fires, in which case `publish` writes the (quantized) value to the
+ * motherboard only if it changed. */
+class MeterPublisher
+{
+public:
+  explicit MeterPublisher(Utils::SampleRateBasedClock::RateLimiter iRateLimiter) : fRateLimiter{iRateLimiter} {}
+
+  inline bool shouldPublish(TJBox_UInt32 iSampleCount) { return fRateLimiter.shouldUpdate(iSampleCount); }
+
+  /**
+   * Rounds `iValue` to a multiple of `iResolution` (if not `0`) so that changes too small to be visible do not
+   * generate a write, then stores it in `ioProperty` (a `JBoxProperty`) if different from the previous value.
+   *
+   * @return `true` if the motherboard was updated */
+  template<typename Property>
+  static bool publish(Property &ioProperty, TJBox_Float32 iValue, TJBox_Float32 iResolution = 0)
+  {
+    if(iResolution > 0)
+      iValue = std::round(iValue / iResolution) * iResolution;
+    return ioProperty.storeValueToMotherboardOnUpdate(iValue);
+  }
+
+private:
+  Utils::SampleRateBasedClock::RateLimiter fRateLimiter;
+};
+
+#endif //__PongasoftCommon_Meter_h__
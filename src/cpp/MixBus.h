@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_MixBus_h__
+#define __PongasoftCommon_MixBus_h__
+
+#include "AudioBuffer.h"
+
+/**
+ * Mixes up to `maxSources` stereo buffers (each with its own gain) into one output buffer in a single pass
+ * (`out = sum(gain[i] * in[i])`). Typical usage (every batch):
+ *
+ * ```
+ * fMixBus.reset();
+ * for(int i = 0; i < N; i++)
+ *   fMixBus.addSource(fInputs[i], fGains[i], fInputPairs[i].isConnected() && !fInputStats[i].isSilent());
+ * fMixBus.mix(fOutput);
+ * ```
+ *
+ * Note that the bus only keeps pointers to the sources so they must remain valid until `mix` is called.
+ */
+template<int size = kBatchSize, int maxSources = 16>
+class TStereoMixBus
+{
+public:
+  using stereo_buffer_type = TStereoAudioBuffer<size>;
+
+public:
+  TStereoMixBus() = default;
+
+  /**
+   * Removes all sources (call before adding the sources for the current batch) */
+  inline void reset() { fSourceCount = 0; }
+
+  /**
+   * Adds a source to the mix. The source is skipped when not enabled (ex: disconnected or silent) or when its gain is
+   * `0` since it would not contribute anything. It is also dropped when `maxSources` sources have already been added.
+   *
+   * @return `true` if the source was added */
+  bool addSource(stereo_buffer_type const &iSource, TJBox_Float32 iGain, bool iEnabled = true)
+  {
+    if(!iEnabled || iGain == 0 || fSourceCount >= maxSources)
+      return false;
+
+    fLeftSources[fSourceCount] = iSource.fLeftAudioBuffer.fAudioBuffer;
+    fRightSources[fSourceCount] = iSource.fRightAudioBuffer.fAudioBuffer;
+    fGains[fSourceCount] = iGain;
+    fSourceCount++;
+
+    return true;
+  }
+
+  inline int getSourceCount() const { return fSourceCount; }
+
+  /**
+   * Computes the mix of all the sources added (silence if there is none) into `oOutput`. */
+  void mix(stereo_buffer_type &oOutput) const
+  {
+    dsp::mix(oOutput.fLeftAudioBuffer.fAudioBuffer, fLeftSources, fGains, fSourceCount, size);
+    dsp::mix(oOutput.fRightAudioBuffer.fAudioBuffer, fRightSources, fGains, fSourceCount, size);
+  }
+
+private:
+  TJBox_AudioSample const *fLeftSources[maxSources]{};
+  TJBox_AudioSample const *fRightSources[maxSources]{};
+  TJBox_Float32 fGains[maxSources]{};
+  int fSourceCount{0};
+};
+
+typedef TStereoMixBus<kBatchSize> StereoMixBus;
+
+#endif //__PongasoftCommon_MixBus_h__
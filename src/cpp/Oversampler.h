@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_Oversampler_h__
+#define __PongasoftCommon_Oversampler_h__
+
+#include "AudioBuffer.h"
+#include "Constants.h"
+#include "DSPKernels.h"
+#include <algorithm>
+
+namespace OversamplerImpl {
+
+// Kaiser window parameter of the halfband filters (~80dB stop band attenuation)
+constexpr TJBox_Float64 kKaiserBeta = 8.0;
+
+// `constexpr` square root (Newton)
+constexpr TJBox_Float64 sqrt(TJBox_Float64 x)
+{
+  if(x <= 0)
+    return 0;
+  TJBox_Float64 res = x < 1 ? 1 : x;
+  for(int i = 0; i < 100; i++)
+    res = (res + x / res) / 2;
+  return res;
+}
+
+// `constexpr` modified Bessel function of the first kind (order 0) used by the Kaiser window
+constexpr TJBox_Float64 besselI0(TJBox_Float64 x)
+{
+  TJBox_Float64 res = 1;
+  TJBox_Float64 term = 1;
+  for(int k = 1; k < 50; k++)
+  {
+    term *= (x / (2 * k)) * (x / (2 * k));
+    res += term;
+  }
+  return res;
+}
+
+/**
+ * Halfband low pass filter (cutoff at a quarter of the (high) sample rate) of length `4 * halfLength - 1`. Every other
+ * coefficient is `0` (except the center one which is `0.5`) so only the `2 * halfLength` others are stored:
+ * `fValues[i] = h[2 * i]`. The filter is symmetric (`fValues[i] = fValues[2 * halfLength - 1 - i]`). */
+template<int halfLength>
+struct HalfbandTable
+{
+  static constexpr int kTapCount = 2 * halfLength;
+
+  TJBox_Float32 fValues[kTapCount]{};
+};
+
+/**
+ * Generates the halfband filter at compile time (Kaiser windowed sinc, normalized for a unity DC gain) */
+template<int halfLength>
+constexpr HalfbandTable<halfLength> makeHalfbandTable()
+{
+  constexpr int N = 4 * halfLength - 1;
+  constexpr int center = 2 * halfLength - 1;
+
+  TJBox_Float64 h[2 * halfLength]{};
+  TJBox_Float64 sum = 0;
+  for(int i = 0; i < 2 * halfLength; i++)
+  {
+    // distance to the center is always odd: sin(pi * n / 2) is +1 or -1
+    auto const n = i * 2 < center ? center - i * 2 : i * 2 - center;
+    auto const sinc = (n % 4 == 1 ? 1.0 : -1.0) / (kPi * n);
+    auto const r = 2.0 * (i * 2) / (N - 1) - 1.0;
+    h[i] = sinc * besselI0(kKaiserBeta * sqrt(1.0 - r * r)) / besselI0(kKaiserBeta);
+    sum += h[i];
+  }
+
+  HalfbandTable<halfLength> res{};
+  for(int i = 0; i < 2 * halfLength; i++)
+    res.fValues[i] = static_cast<TJBox_Float32>(h[i] * 0.5 / sum); // the center tap is the other 0.5
+  return res;
+}
+
+template<int halfLength>
+inline constexpr HalfbandTable<halfLength> kHalfbandTable = makeHalfbandTable<halfLength>();
+
+/**
+ * Upsamples by 2 (`inputSize` samples in, `2 * inputSize` out) with a polyphase halfband filter: the even outputs are
+ * the `2 * halfLength` taps FIR and the odd ones are simply the delayed input (center tap). Latency is
+ * `2 * halfLength - 1` samples at the high rate. */
+template<int halfLength, int inputSize>
+class THalfbandUpsampler
+{
+public:
+  static constexpr int kTapCount = 2 * halfLength;
+  static constexpr int kHistorySize = kTapCount - 1;
+
+  void process(TJBox_AudioSample const *iSrc, TJBox_AudioSample *oDst)
+  {
+    auto const &taps = kHalfbandTable<halfLength>.fValues;
+
+    std::copy(iSrc, iSrc + inputSize, fHistory + kHistorySize);
+
+    // even phase (the filter is symmetric so it is not reversed), with a gain of 2 to compensate for the zero stuffing
+    dsp::clear(fEven, inputSize);
+    for(int i = 0; i < kTapCount; i++)
+      dsp::accumulate(fEven, fHistory + i, 2.0f * taps[i], inputSize);
+
+    // odd phase: 2 * 0.5 * x[n - (halfLength - 1)]
+    for(int n = 0; n < inputSize; n++)
+    {
+      oDst[2 * n] = fEven[n];
+      oDst[2 * n + 1] = fHistory[n + halfLength];
+    }
+
+    std::copy(fHistory + inputSize, fHistory + inputSize + kHistorySize, fHistory);
+  }
+
+  void reset() { std::fill(std::begin(fHistory), std::end(fHistory), 0); }
+
+private:
+  TJBox_AudioSample fHistory[kHistorySize + inputSize]{};
+  TJBox_AudioSample fEven[inputSize]{};
+};
+
+/**
+ * Decimates by 2 (`2 * outputSize` samples in, `outputSize` out) with the same halfband filter as
+ * `THalfbandUpsampler`: only the outputs which are kept are computed and only the non zero taps are applied. Latency
+ * is `2 * halfLength - 1` samples at the high rate. */
+template<int halfLength, int outputSize>
+class THalfbandDecimator
+{
+public:
+  static constexpr int kTapCount = 2 * halfLength;
+  static constexpr int kEvenHistorySize = kTapCount - 1;
+  static constexpr int kOddHistorySize = halfLength;
+
+  void process(TJBox_AudioSample const *iSrc, TJBox_AudioSample *oDst)
+  {
+    auto const &taps = kHalfbandTable<halfLength>.fValues;
+
+    for(int n = 0; n < outputSize; n++)
+    {
+      fEven[kEvenHistorySize + n] = iSrc[2 * n];
+      fOdd[kOddHistorySize + n] = iSrc[2 * n + 1];
+    }
+
+    // center tap: 0.5 * x[2 * (n - halfLength) + 1]
+    dsp::copy(oDst, fOdd, outputSize);
+    dsp::adjustGain(oDst, 0.5f, outputSize);
+    for(int i = 0; i < kTapCount; i++)
+      dsp::accumulate(oDst, fEven + i, taps[i], outputSize);
+
+    std::copy(fEven + outputSize, fEven + outputSize + kEvenHistorySize, fEven);
+    std::copy(fOdd + outputSize, fOdd + outputSize + kOddHistorySize, fOdd);
+  }
+
+  void reset()
+  {
+    std::fill(std::begin(fEven), std::end(fEven), 0);
+    std::fill(std::begin(fOdd), std::end(fOdd), 0);
+  }
+
+private:
+  TJBox_AudioSample fEven[kEvenHistorySize + outputSize]{};
+  TJBox_AudioSample fOdd[kOddHistorySize + outputSize]{};
+};
+
+// 47 taps: flat (< 0.001dB) up to 0.18 and attenuated by 80dB above 0.32 (of the 2x rate)
+constexpr int kStage1HalfLength = 12;
+
+// 23 taps (2x -> 4x): the content is already band limited to a quarter of the 2x rate so the transition band is wider
+constexpr int kStage2HalfLength = 6;
+
+}
+
+/**
+ * Runs a (non linear) kernel at 2x or 4x the sample rate to reduce aliasing (saturation, waveshaping...): the batch is
+ * upsampled to `factor * size` samples, processed by the kernel and decimated back, using polyphase halfband FIR
+ * filters (computed at compile time) which keep their state between batches. Typical usage (every batch):
+ *
+ * ```
+ * fOversampler.process(buffer, [drive](TJBox_AudioSample *ioSamples, int iCount) {
+ *   dsp::softClip(ioSamples, drive, 1.0f, iCount);
+ * });
+ * ```
+ *
+ * Use one instance per channel. The output is delayed by `kLatency` samples (at the original sample rate, `23` for 2x
+ * and `28.5` for 4x) whatever the kernel.
+ */
+template<int factor, int size = kBatchSize>
+class TOversampler
+{
+  static_assert(factor == 2 || factor == 4, "only 2x and 4x are supported");
+
+public:
+  static constexpr int kOversampledSize = factor * size;
+
+  // exact latency in samples at the original rate (each halfband stage adds 2 * halfLength - 1 samples at its high
+  // rate, once for upsampling and once for decimating)
+  static constexpr TJBox_Float32 kLatency =
+    factor == 2 ?
+    static_cast<TJBox_Float32>(2 * OversamplerImpl::kStage1HalfLength - 1) :
+    static_cast<TJBox_Float32>(2 * OversamplerImpl::kStage1HalfLength - 1) +
+    static_cast<TJBox_Float32>(2 * OversamplerImpl::kStage2HalfLength - 1) / 2.0f;
+
+  /**
+   * Processes `size` samples in place: `iKernel(TJBox_AudioSample *ioSamples, int iCount)` is called once with the
+   * `kOversampledSize` upsampled samples to modify in place */
+  template<typename Kernel>
+  void process(TJBox_AudioSample *ioSamples, Kernel &&iKernel)
+  {
+    if constexpr(factor == 2)
+    {
+      fStage1Up.process(ioSamples, fOversampled);
+      iKernel(fOversampled, kOversampledSize);
+      fStage1Down.process(fOversampled, ioSamples);
+    }
+    else
+    {
+      fStage1Up.process(ioSamples, fStage2);
+      fStage2Up.process(fStage2, fOversampled);
+      iKernel(fOversampled, kOversampledSize);
+      fStage2Down.process(fOversampled, fStage2);
+      fStage1Down.process(fStage2, ioSamples);
+    }
+  }
+
+  template<typename Kernel>
+  inline void process(TAudioBuffer<size> &ioBuffer, Kernel &&iKernel)
+  {
+    process(ioBuffer.fAudioBuffer, std::forward<Kernel>(iKernel));
+  }
+
+  /**
+   * Clears the filters state (ex: on transport restart) */
+  void reset()
+  {
+    fStage1Up.reset();
+    fStage1Down.reset();
+    if constexpr(factor == 4)
+    {
+      fStage2Up.reset();
+      fStage2Down.reset();
+    }
+  }
+
+  inline static constexpr TJBox_Float32 getLatency() { return kLatency; }
+
+private:
+  static constexpr int kStage2Size = factor == 4 ? 2 * size : 1;
+
+  OversamplerImpl::THalfbandUpsampler<OversamplerImpl::kStage1HalfLength, size> fStage1Up{};
+  OversamplerImpl::THalfbandDecimator<OversamplerImpl::kStage1HalfLength, size> fStage1Down{};
+  OversamplerImpl::THalfbandUpsampler<OversamplerImpl::kStage2HalfLength, kStage2Size> fStage2Up{};
+  OversamplerImpl::THalfbandDecimator<OversamplerImpl::kStage2HalfLength, kStage2Size> fStage2Down{};
+  TJBox_AudioSample fStage2[kStage2Size]{};
+  TJBox_AudioSample fOversampled[kOversampledSize]{};
+};
+
+typedef TOversampler<2> Oversampler2x;
+typedef TOversampler<4> Oversampler4x;
+
+#endif //__PongasoftCommon_Oversampler_h__
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_Pan_h__
+#define __PongasoftCommon_Pan_h__
+
+#include "JukeboxTypes.h"
+#include "Constants.h"
+#include "XFade.h"
+#include <algorithm>
+
+/**
+ * Gains to apply to the left and right channels (see `TStereoAudioBuffer::adjustGain(PanGains)`) */
+struct PanGains
+{
+  TJBox_Float32 fLeft{1.0f};
+  TJBox_Float32 fRight{1.0f};
+};
+
+namespace PanImpl {
+
+constexpr int kSinTableSize = 256;
+
+/**
+ * `sin(i / kSinTableSize * pi / 2)` for `i` in `[0, kSinTableSize]` (generated at compile time and shared) */
+struct SinTable
+{
+  TJBox_Float32 fValues[kSinTableSize + 1];
+};
+
+constexpr SinTable makeSinTable()
+{
+  SinTable res{};
+  for(int i = 0; i <= kSinTableSize; i++)
+    res.fValues[i] = static_cast<TJBox_Float32>(XFadeImpl::sinHalfPi(static_cast<TJBox_Float64>(i) / kSinTableSize));
+  return res;
+}
+
+inline constexpr SinTable kSinTable = makeSinTable();
+
+/**
+ * `sin(t * pi / 2)` for `t` in `[0, 1]` (clamped) using the table with linear interpolation (max error 5e-6) */
+inline TJBox_Float32 sinHalfPi(TJBox_Float32 t)
+{
+  auto const x = clamp2(t, 0.0f, 1.0f) * kSinTableSize;
+  auto const i = std::min(static_cast<int>(x), kSinTableSize - 1);
+  auto const f = x - static_cast<TJBox_Float32>(i);
+  return kSinTable.fValues[i] + f * (kSinTable.fValues[i + 1] - kSinTable.fValues[i]);
+}
+
+}
+
+/**
+ * Constant power pan law: `iPan` in `[-1, 1]` (-1 is hard left, 0 is center, 1 is hard right) => left gain is
+ * `cos(t * pi / 2)` and right gain is `sin(t * pi / 2)` with `t = (iPan + 1) / 2` (so `left^2 + right^2 = 1` and the
+ * center is -3dB on each channel). */
+inline PanGains computePanGains(TJBox_Float32 iPan)
+{
+  auto const t = (iPan + 1.0f) * 0.5f;
+  return PanGains{PanImpl::sinHalfPi(1.0f - t), PanImpl::sinHalfPi(t)};
+}
+
+/**
+ * Balance: `iBalance` in `[-1, 1]`. The center leaves both channels untouched (unity) and moving towards one side
+ * attenuates the other channel only (`cos(|iBalance| * pi / 2)`, so the opposite channel is muted at -1 or 1). */
+inline PanGains computeBalanceGains(TJBox_Float32 iBalance)
+{
+  if(iBalance >= 0)
+    return PanGains{PanImpl::sinHalfPi(1.0f - iBalance), 1.0f};
+  else
+    return PanGains{1.0f, PanImpl::sinHalfPi(1.0f + iBalance)};
+}
+
+#endif //__PongasoftCommon_Pan_h__
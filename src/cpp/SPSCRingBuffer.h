@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_SPSCRingBuffer_h__
+#define __PongasoftCommon_SPSCRingBuffer_h__
+
+// threads (and std::atomic) are not available in the Jukebox build: native tools only (tests, analysis...)
+#if LOCAL_NATIVE_BUILD
+
+#include "AudioBuffer.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Wait free ring buffer to hand off data from exactly one producer thread (ex: the render loop) to exactly one
+ * consumer thread (ex: a worker writing a file). For N consumers, use N rings (the producer pushes to each of them).
+ *
+ * - `push`/`pop` never block: they return `false` (or the number of elements transferred for the bulk versions) when
+ *   the ring is full (resp. empty)
+ * - the bulk versions transfer up to `iCount` elements with at most 2 contiguous copies and one atomic store
+ * - the write index is published with release semantics after the elements are written and read with acquire
+ *   semantics by the consumer (and symmetrically for the read index)
+ * - each index lives on its own cache line, next to the copy of the other index cached by the same thread (refreshed
+ *   only when the ring looks full/empty) to avoid bouncing cache lines between the 2 threads
+ *
+ * `N` (the capacity) must be a power of 2. The storage is inline, so a big ring should be allocated on the heap.
+ */
+template<typename T, int N>
+class TSPSCRingBuffer
+{
+  static_assert(N > 0 && (N & (N - 1)) == 0, "N must be a power of 2");
+  static_assert(N <= (1 << 30), "N is too big");
+
+public:
+  static constexpr int kCacheLineSize = 64;
+
+  TSPSCRingBuffer() = default;
+  TSPSCRingBuffer(TSPSCRingBuffer const &) = delete;
+  TSPSCRingBuffer &operator=(TSPSCRingBuffer const &) = delete;
+
+  constexpr int getCapacity() const { return N; }
+
+  //------------------------------------------------------------------------
+  // Producer thread
+  //------------------------------------------------------------------------
+
+  /**
+   * @return the number of elements that can be pushed (at least) */
+  inline int getWriteAvailable() const
+  {
+    auto const writeIndex = fWriteIndex.load(std::memory_order_relaxed);
+    return N - static_cast<int>(writeIndex - fReadIndex.load(std::memory_order_acquire));
+  }
+
+  inline bool push(T const &iElement) { return push(&iElement, 1) == 1; }
+
+  /**
+   * Pushes up to `iCount` elements
+   *
+   * @return the number of elements pushed */
+  int push(T const *iSrc, int iCount)
+  {
+    auto const writeIndex = fWriteIndex.load(std::memory_order_relaxed);
+    auto available = N - static_cast<int>(writeIndex - fCachedReadIndex);
+    if(available < iCount)
+    {
+      fCachedReadIndex = fReadIndex.load(std::memory_order_acquire);
+      available = N - static_cast<int>(writeIndex - fCachedReadIndex);
+    }
+
+    auto const count = std::min(iCount, available);
+    if(count <= 0)
+      return 0;
+
+    auto const start = static_cast<int>(writeIndex & kMask);
+    auto const first = std::min(count, N - start);
+    std::copy(iSrc, iSrc + first, fBuf + start);
+    std::copy(iSrc + first, iSrc + count, fBuf);
+
+    fWriteIndex.store(writeIndex + static_cast<uint32_t>(count), std::memory_order_release);
+    return count;
+  }
+
+  /**
+   * Pushes the whole batch or nothing (when there is not enough room)
+   *
+   * @return `true` if the batch was pushed */
+  template<int size>
+  inline bool push(TAudioBuffer<size> const &iBuffer)
+  {
+    static_assert(std::is_same_v<T, TJBox_AudioSample>);
+    if(getWriteAvailable() < size)
+      return false;
+    return push(iBuffer.fAudioBuffer, size) == size;
+  }
+
+  //------------------------------------------------------------------------
+  // Consumer thread
+  //------------------------------------------------------------------------
+
+  /**
+   * @return the number of elements that can be popped (at least) */
+  inline int getReadAvailable() const
+  {
+    auto const readIndex = fReadIndex.load(std::memory_order_relaxed);
+    return static_cast<int>(fWriteIndex.load(std::memory_order_acquire) - readIndex);
+  }
+
+  inline bool pop(T &oElement) { return pop(&oElement, 1) == 1; }
+
+  /**
+   * Pops up to `iCount` elements
+   *
+   * @return the number of elements popped */
+  int pop(T *oDst, int iCount)
+  {
+    auto const readIndex = fReadIndex.load(std::memory_order_relaxed);
+    auto available = static_cast<int>(fCachedWriteIndex - readIndex);
+    if(available < iCount)
+    {
+      fCachedWriteIndex = fWriteIndex.load(std::memory_order_acquire);
+      available = static_cast<int>(fCachedWriteIndex - readIndex);
+    }
+
+    auto const count = std::min(iCount, available);
+    if(count <= 0)
+      return 0;
+
+    auto const start = static_cast<int>(readIndex & kMask);
+    auto const first = std::min(count, N - start);
+    std::copy(fBuf + start, fBuf + start + first, oDst);
+    std::copy(fBuf, fBuf + count - first, oDst + first);
+
+    fReadIndex.store(readIndex + static_cast<uint32_t>(count), std::memory_order_release);
+    return count;
+  }
+
+  /**
+   * Pops a whole batch or nothing (when not enough elements are available)
+   *
+   * @return `true` if the batch was popped */
+  template<int size>
+  inline bool pop(TAudioBuffer<size> &oBuffer)
+  {
+    static_assert(std::is_same_v<T, TJBox_AudioSample>);
+    if(getReadAvailable() < size)
+      return false;
+    return pop(oBuffer.fAudioBuffer, size) == size;
+  }
+
+private:
+  // indexes are never wrapped (only when accessing fBuf) so that full (N) and empty (0) are different
+  static constexpr uint32_t kMask = N - 1;
+
+  // producer
+  alignas(kCacheLineSize) std::atomic<uint32_t> fWriteIndex{0};
+  uint32_t fCachedReadIndex{0};
+
+  // consumer
+  alignas(kCacheLineSize) std::atomic<uint32_t> fReadIndex{0};
+  uint32_t fCachedWriteIndex{0};
+
+  alignas(kCacheLineSize) T fBuf[N]{};
+};
+
+#endif // LOCAL_NATIVE_BUILD
+
+#endif //__PongasoftCommon_SPSCRingBuffer_h__
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_SlidingWindow_h__
+#define __PongasoftCommon_SlidingWindow_h__
+
+#include "AudioBuffer.h"
+#include "CircularBuffer.h"
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+namespace SlidingWindowImpl {
+
+/**
+ * Monotonic deque: the values pushed which can still be the extremum of the window (ordered by `Compare` from the
+ * front), so that each value is pushed and popped at most once (amortized O(1)) */
+template<typename T, typename Compare>
+class Extremum
+{
+public:
+  explicit Extremum(int iSize) : fSize{iSize}, fEntries(iSize) {}
+
+  void push(T iValue, int64_t iIndex)
+  {
+    // drop the value which leaves the window (so that there is always room for the new one)
+    if(fCount > 0 && fEntries[fFront].fIndex <= iIndex - fSize)
+    {
+      fFront = adjustIndex(fFront + 1);
+      fCount--;
+    }
+
+    // drop the values which can no longer be the extremum
+    while(fCount > 0 && !Compare{}(back().fValue, iValue))
+      fCount--;
+
+    fEntries[adjustIndex(fFront + fCount)] = {iValue, iIndex};
+    fCount++;
+  }
+
+  inline T get() const { return fCount > 0 ? fEntries[fFront].fValue : T{}; }
+
+  inline void reset()
+  {
+    fFront = 0;
+    fCount = 0;
+  }
+
+private:
+  struct Entry
+  {
+    T fValue;
+    int64_t fIndex;
+  };
+
+  inline Entry const &back() const { return fEntries[adjustIndex(fFront + fCount - 1)]; }
+  inline int adjustIndex(int iIndex) const { return iIndex >= fSize ? iIndex - fSize : iIndex; }
+
+private:
+  int fSize;
+  std::vector<Entry> fEntries;
+  int fFront{0};
+  int fCount{0};
+};
+
+}
+
+/**
+ * Keeps the history of the last `iSize` values pushed (in a `CircularBuffer`) and maintains, as they are pushed, the
+ * sum, min and max of the window so that each query is O(1) (instead of `CircularBuffer::fold` walking the whole
+ * window):
+ *
+ * - the sum is a running sum (add the value pushed, subtract the value leaving the window). For floating point types
+ *   the rounding errors accumulate, so it is recomputed from the history every `iSize` values (amortized O(1))
+ * - min and max use a monotonic deque
+ *
+ * Until the window is full, the aggregates only cover the values pushed (`getCount()`).
+ */
+template<typename T>
+class SlidingWindow
+{
+public:
+  explicit SlidingWindow(int iSize) : fHistory{iSize}, fMin{iSize}, fMax{iSize} { reset(); }
+
+  void push(T iValue)
+  {
+    fSum += iValue - fHistory.getAt(0); // oldest value (or 0 when the window is not full)
+    fHistory.setAt(0, iValue);
+    fHistory.incrementHead();
+    fMin.push(iValue, fIndex);
+    fMax.push(iValue, fIndex);
+    fIndex++;
+
+    if constexpr(std::is_floating_point_v<T>)
+    {
+      if(fIndex % getSize() == 0)
+        resyncSum();
+    }
+  }
+
+  inline void push(T const *iValues, int iCount)
+  {
+    for(int i = 0; i < iCount; i++)
+      push(iValues[i]);
+  }
+
+  template<int size>
+  inline void push(TAudioBuffer<size> const &iBuffer) { push(iBuffer.fAudioBuffer, size); }
+
+  inline int getSize() const { return fHistory.getSize(); }
+
+  /**
+   * @return the number of values in the window (`getSize()` once the window is full) */
+  inline int getCount() const { return fIndex < getSize() ? static_cast<int>(fIndex) : getSize(); }
+
+  inline T getSum() const { return fSum; }
+  inline T getMean() const { return fIndex == 0 ? T{} : fSum / static_cast<T>(getCount()); }
+
+  /**
+   * @return the min of the window (`T{}` when empty) */
+  inline T getMin() const { return fMin.get(); }
+
+  /**
+   * @return the max of the window (`T{}` when empty) */
+  inline T getMax() const { return fMax.get(); }
+
+  /**
+   * @return the values of the window (`getHistory().getAt(-1)` is the last value pushed) */
+  inline CircularBuffer<T> const &getHistory() const { return fHistory; }
+
+  void reset()
+  {
+    fHistory.init(T{});
+    fMin.reset();
+    fMax.reset();
+    fSum = T{};
+    fIndex = 0;
+  }
+
+private:
+  void resyncSum()
+  {
+    auto sum = [](T a, T b) { return a + b; };
+    // fold excludes its end offset: the whole window is [0, getSize())
+    fSum = fHistory.fold(1, getSize(), fHistory.getAt(0), sum);
+  }
+
+private:
+  CircularBuffer<T> fHistory;
+  SlidingWindowImpl::Extremum<T, std::less<T>> fMin;
+  SlidingWindowImpl::Extremum<T, std::greater<T>> fMax;
+  T fSum{};
+  int64_t fIndex{0};
+};
+
+#endif //__PongasoftCommon_SlidingWindow_h__
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_Smoother_h__
+#define __PongasoftCommon_Smoother_h__
+
+#include "Constants.h"
+#include "SampleRateBasedClock.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * One pole smoother: the value moves exponentially towards the target (`y[n] = y[n-1] + (1 - r) * (target - y[n-1])`)
+ * and snaps to the target once the distance is below `precision` (settled state). Usage (every batch):
+ *
+ * ```
+ * fSmoother.setTargetValue(targetGain);
+ * if(fSmoother.isSettled())
+ *   buffer.adjustGain(fSmoother.getValue()); // no per sample cost
+ * else
+ * {
+ *   fSmoother.nextBatch(fGains); // per sample values of the batch
+ *   buffer.applyGains(fGains);
+ * }
+ * ```
+ *
+ * By default (for backward compatibility with `VolumeState` and `Utils::FilteredValue`), the value moves 1/100 of the
+ * remaining distance per batch, which depends on the sample rate. Call `setTimeConstant` to make the response time
+ * independent of the sample rate.
+ */
+template<int size = kBatchSize>
+class TOnePoleSmoother
+{
+public:
+  explicit TOnePoleSmoother(TJBox_Float32 iValue = 0, TJBox_Float32 iPrecision = 0.01f) :
+    fValue{iValue}, fTargetValue{iValue}, fPrecision{iPrecision}
+  {
+    // 1/100 per batch
+    setBatchDecay(0.99);
+  }
+
+  /**
+   * Sets the time constant: the distance to the target is divided by `e` every `iMillis` ms (`0` means no
+   * smoothing). Must be called again when the sample rate changes. */
+  void setTimeConstant(Utils::SampleRateBasedClock const &iClock, TJBox_Float64 iMillis)
+  {
+    auto const samples = iMillis * iClock.getSampleRate() / 1000.0;
+    setBatchDecay(samples > 0 ? std::exp(-size / samples) : 0);
+  }
+
+  inline void setTargetValue(TJBox_Float32 iTargetValue) { fTargetValue = iTargetValue; }
+
+  /**
+   * Sets the value and the target (no smoothing) */
+  inline void setValue(TJBox_Float32 iValue) { fValue = fTargetValue = iValue; }
+
+  inline TJBox_Float32 getValue() const { return fValue; }
+  inline TJBox_Float32 getTargetValue() const { return fTargetValue; }
+
+  /**
+   * @return `true` when the value has reached the target (in which case `nextBatch` does nothing) */
+  inline bool isSettled() const { return fValue == fTargetValue; }
+
+  /**
+   * Moves the value by one batch
+   *
+   * @return `true` if the value changed */
+  inline bool nextBatch()
+  {
+    if(isSettled())
+      return false;
+
+    if(isWithinPrecision())
+      fValue = fTargetValue;
+    else
+      fValue = fTargetValue + (fValue - fTargetValue) * fBatchDecay;
+    return true;
+  }
+
+  /**
+   * Moves the value by one batch and fills `oValues` (`size` values) with the value for each sample (the last one being
+   * the new value, same as `nextBatch()`). When settled, `oValues` is filled with the (constant) value.
+   *
+   * @return `true` if the value changed */
+  inline bool nextBatch(TJBox_Float32 *oValues)
+  {
+    if(isSettled())
+    {
+      std::fill(oValues, oValues + size, fValue);
+      return false;
+    }
+
+    if(isWithinPrecision())
+    {
+      fValue = fTargetValue;
+      std::fill(oValues, oValues + size, fValue);
+    }
+    else
+    {
+      // oValues[i] = target + (value - target) * r^(i+1)
+      auto const distance = fValue - fTargetValue;
+      auto d = distance;
+      for(int i = 0; i < size - 1; i++)
+      {
+        d *= fSampleDecay;
+        oValues[i] = fTargetValue + d;
+      }
+      fValue = fTargetValue + distance * fBatchDecay;
+      oValues[size - 1] = fValue;
+    }
+    return true;
+  }
+
+private:
+  // r (per sample) with r^size = iBatchDecay
+  void setBatchDecay(TJBox_Float64 iBatchDecay)
+  {
+    fBatchDecay = static_cast<TJBox_Float32>(iBatchDecay);
+    fSampleDecay = static_cast<TJBox_Float32>(std::pow(iBatchDecay, 1.0 / size));
+  }
+
+  inline bool isWithinPrecision() const { return std::abs(fValue - fTargetValue) < fPrecision; }
+
+private:
+  TJBox_Float32 fValue;
+  TJBox_Float32 fTargetValue;
+  TJBox_Float32 fPrecision;
+  TJBox_Float32 fSampleDecay{};
+  TJBox_Float32 fBatchDecay{};
+};
+
+typedef TOnePoleSmoother<kBatchSize> OnePoleSmoother;
+
+#endif //__PongasoftCommon_Smoother_h__
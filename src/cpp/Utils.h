@@ -7,6 +7,7 @@
 
 
 #include "JukeboxTypes.h"
+#include "Constants.h"
 #include <cmath>
 #include <logging.h>
 
@@ -236,6 +237,9 @@ inline constexpr TJBox_Float64 mapValueDP(TJBox_Float64 iValue, TJBox_Float64 iF
  * - call `adjustValue` on every batch
  * - call `getValue` to get the current filtered value
  *
+ * For single precision values, `OnePoleSmoother` (`Smoother.h`) has the same default behavior and can be made
+ * independent of the sample rate (`setTimeConstant`).
+ *
  * @tparam T
  */
 template<typename T = TJBox_Float32, T precision = static_cast<T>(0.01)>
@@ -7,84 +7,178 @@
 #define __Volume_H_
 
 #include "JBoxProperty.h"
+#include "Smoother.h"
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 
 TJBox_Float32 const Volume_Init_Value = 1.0f;
 
-inline TJBox_Float32 toVolumeCube(TJBox_Value value)
+namespace VolumeImpl {
+
+// the volume (in [0, 1]) which maps to a gain of 1 (unity)
+constexpr TJBox_Float32 kUnityVolume = 0.7f;
+constexpr TJBox_Float32 kInverseUnityVolume = 1.0f / kUnityVolume;
+
+// volumes this close to kUnityVolume map to a gain of exactly 1
+constexpr TJBox_Float32 kUnityVolumeThreshold = 1e-5f;
+
+/**
+ * `(volume / 0.7)^3` with the unity shortcut (shared by all the `toVolumeCube` versions so that they always agree).
+ * Written without branch so that loops using it can be vectorized. */
+inline TJBox_Float32 toGain(TJBox_Float32 iVolume)
 {
-  // Volume [0..1]
-  TJBox_Float32 vol = JBox::toJBoxFloat32(value);
+  auto const correctedVolume = iVolume * kInverseUnityVolume;
+  auto const gain = correctedVolume * correctedVolume * correctedVolume;
+  return std::fabs(iVolume - kUnityVolume) < kUnityVolumeThreshold ? Volume_Init_Value : gain;
+}
 
-  // shortcut... unity
-  if(std::fabs(vol - 0.7f) < 1e-5)
-  {
-    return Volume_Init_Value;
-  }
+/**
+ * Fast cube root for `x >= 0` (returns `0` for `x <= 0`) without any call to `std::pow` nor any division: the exponent
+ * (and mantissa) of `x` provides an estimate of `x^(-1/3)` (within 0.5%) which is then refined with 3 Newton
+ * iterations and multiplied by `x^(2/3)`.
+ *
+ * Maximum relative error: 4e-7 (a few ulps) over the full (normalized) float range. */
+inline TJBox_Float32 fastCbrt(TJBox_Float32 x)
+{
+  // no branch so that loops using it can be vectorized: negative values are replaced by 0 (sign bit set => all bits
+  // cleared) which is then handled by the formula
+  uint32_t bits;
+  std::memcpy(&bits, &x, sizeof(bits));
+  bits &= ~static_cast<uint32_t>(static_cast<int32_t>(bits) >> 31);
+  std::memcpy(&x, &bits, sizeof(x));
+
+  bits = 0x54a21d2a - bits / 3;
+  TJBox_Float32 r;
+  std::memcpy(&r, &bits, sizeof(r));
+
+  // r = x^(-1/3) => r' = r * (4 - x * r^3) / 3
+  for(int i = 0; i < 3; i++)
+    r = r * (4.0f / 3.0f) - (x * r) * (r * r) * (r * (1.0f / 3.0f));
+
+  // x^(1/3) = x * (x^(-1/3))^2
+  return x * r * r;
+}
 
-  const TJBox_Float32 correctedVolume = vol / 0.7f;
-  TJBox_Float32 targetGain = correctedVolume * correctedVolume * correctedVolume;
+}
 
-  return targetGain;
+/**
+ * Converts a volume (in [0, 1], 0.7 being unity) into a gain: `(volume / 0.7)^3` */
+inline TJBox_Float32 toVolumeCube(TJBox_Float32 iVolume)
+{
+  return VolumeImpl::toGain(iVolume);
+}
+
+inline TJBox_Float32 toVolumeCube(TJBox_Value value)
+{
+  // Volume [0..1]
+  return toVolumeCube(JBox::toJBoxFloat32(value));
 }
 
 inline void toVolumeCube(TJBox_Value value, TJBox_Float32 &oValue) { oValue = toVolumeCube(value); }
 
+/**
+ * Converts `iCount` volumes into gains (see `toVolumeCube(TJBox_Float32)`) */
+inline void toVolumeCube(TJBox_Float32 const *iVolumes, TJBox_Float32 *oGains, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+    oGains[i] = VolumeImpl::toGain(iVolumes[i]);
+}
+
+/**
+ * Inverse of `toVolumeCube`: `gain^(1/3) * 0.7` (uses `VolumeImpl::fastCbrt`, max relative error 4e-7, instead of a
+ * double precision `std::pow`) */
+inline TJBox_Float32 fromVolumeCubeToFloat(TJBox_Float32 iGain)
+{
+  // no need for a unity shortcut: fastCbrt(1) is exactly 1
+  return VolumeImpl::fastCbrt(iGain) * VolumeImpl::kUnityVolume;
+}
+
 inline TJBox_Value fromVolumeCube(TJBox_Float32 value)
 {
   // (value ^ 1/3) * 0.7f
-  return JBox_MakeNumber(std::pow(value, 1.0/3) * 0.7f);
+  return JBox_MakeNumber(fromVolumeCubeToFloat(value));
+}
+
+/**
+ * Converts `iCount` gains into volumes (see `fromVolumeCubeToFloat`). Written without branch so that the compiler can
+ * vectorize it. */
+inline void fromVolumeCube(TJBox_Float32 const *iGains, TJBox_Float32 *oVolumes, int iCount)
+{
+  for(int i = 0; i < iCount; i++)
+    oVolumes[i] = fromVolumeCubeToFloat(iGains[i]);
 }
 
 typedef JBoxProperty<TJBox_Float32, toVolumeCube, fromVolumeCube> VolumeCubeJBoxProperty;
 
+/**
+ * Converts a sample into dB (`-inf` for silence). Use `dsp::linearToDb` (`DSPKernels.h`) to convert many values at
+ * once. */
 inline TJBox_Float64 toVolume(TJBox_AudioSample audioSample)
 {
   return std::log10(audioSample) * 20;
 }
 
+/**
+ * Smooths volume changes when the filter is on (see `TOnePoleSmoother`): by default the volume moves 1/100 of the
+ * remaining distance per batch, call `setTimeConstant` for a response time independent of the sample rate. */
 class VolumeState
 {
 public:
-  VolumeState(TJBox_Float32 iVolume, bool iFilterOn): fVolume(iVolume), fFilterOn(iFilterOn) {};
+  VolumeState(TJBox_Float32 iVolume, bool iFilterOn): fSmoother(iVolume, 0.01f), fFilterOn(iFilterOn) {};
 
   inline void update(const VolumeState &rhs)
   {
-    fVolume = rhs.fVolume;
+    fSmoother.setValue(rhs.getVolume());
     fFilterOn = rhs.fFilterOn;
   }
 
+  inline void setTimeConstant(Utils::SampleRateBasedClock const &iClock, TJBox_Float64 iMillis)
+  {
+    fSmoother.setTimeConstant(iClock, iMillis);
+  }
+
   bool adjustVolume(TJBox_Float32 iTargetVolume)
   {
-    TJBox_Float32 previousVolume = fVolume;
+    TJBox_Float32 previousVolume = getVolume();
 
     if(!fFilterOn)
-    {
-      fVolume = iTargetVolume;
-    }
+      fSmoother.setValue(iTargetVolume);
     else
     {
       // Filter changes to avoid nasty sounds.
-      if(std::abs(fVolume - iTargetVolume) < 0.01f)
-      {
-        fVolume = iTargetVolume;
-      }
-      else
-      {
-        fVolume += (iTargetVolume - fVolume) / 100.0f;
-        //JBOX_TRACE((std::string("volume adjusted... ") + std::to_string(previousVolume) + " to " + std::to_string(fVolume) + " target=" + std::to_string(iTargetVolume)).c_str());
-      }
+      fSmoother.setTargetValue(iTargetVolume);
+      fSmoother.nextBatch();
     }
 
-    return previousVolume != fVolume;
+    return previousVolume != getVolume();
   }
 
-  inline TJBox_Float32 getVolume() const { return fVolume; }
+  /**
+   * Same as `adjustVolume(iTargetVolume)` but also fills `oVolumes` (`kBatchSize` values) with the volume for each
+   * sample of the batch (use with `TAudioBuffer::applyGains`). Check `isSettled` first to avoid the per sample cost
+   * when the volume is not changing. */
+  bool adjustVolume(TJBox_Float32 iTargetVolume, TJBox_Float32 *oVolumes)
+  {
+    if(!fFilterOn)
+    {
+      auto res = adjustVolume(iTargetVolume);
+      std::fill(oVolumes, oVolumes + kBatchSize, getVolume());
+      return res;
+    }
+
+    fSmoother.setTargetValue(iTargetVolume);
+    return fSmoother.nextBatch(oVolumes);
+  }
+
+  inline TJBox_Float32 getVolume() const { return fSmoother.getValue(); }
+
+  inline bool isSettled() const { return fSmoother.isSettled(); }
 
   inline void setFilterOn(bool iFilterOn) { fFilterOn = iFilterOn; }
 
 private:
-  TJBox_Float32 fVolume;
+  OnePoleSmoother fSmoother;
   bool fFilterOn;
 };
 
@@ -9,13 +9,43 @@
 #include "JukeboxTypes.h"
 #include "Jukebox.h"
 
+/**
+ * The values of a cross fade curve: `fXFadeFunction[i]` is applied to the first buffer and `fReverseXFadeFunction[i]`
+ * to the second one (precomputed so that the cross fade can be vectorized).
+ *
+ * The predefined curves are generated at compile time (see `makeXFadeTable`) and stored once (read only) per size.
+ */
 template <int size>
-class XFade
+struct XFadeTable
 {
-public:
-  TJBox_Float64 fXFadeFunction[size];
+  TJBox_Float32 fXFadeFunction[size];
+  TJBox_Float32 fReverseXFadeFunction[size];
+
+  /**
+   * For a table filled at runtime (instead of `makeXFadeTable`): fill `fXFadeFunction` then call this method to
+   * compute `fReverseXFadeFunction` as the curve read backward (`fXFadeFunction[size - 1 - i]`) */
+  void updateReverseXFadeFunction()
+  {
+    for(int i = 0; i < size; i++)
+      fReverseXFadeFunction[i] = fXFadeFunction[size - 1 - i];
+  }
 };
 
+/**
+ * Generates a table at compile time: `iXFade(i)` and `iReverseXFade(i)` are called for each `i` in `[0, size)` and
+ * must be `constexpr`. */
+template <int size, typename XFadeFunction, typename ReverseXFadeFunction>
+constexpr XFadeTable<size> makeXFadeTable(XFadeFunction iXFade, ReverseXFadeFunction iReverseXFade)
+{
+  XFadeTable<size> res{};
+  for(int i = 0; i < size; i++)
+  {
+    res.fXFadeFunction[i] = static_cast<TJBox_Float32>(iXFade(i));
+    res.fReverseXFadeFunction[i] = static_cast<TJBox_Float32>(iReverseXFade(i));
+  }
+  return res;
+}
+
 /*
   cross fade linear
   formula is 0.5 * (1 + t) with t[-1, +1]
@@ -23,7 +53,32 @@ public:
   => t = -1 + (n * a) with n from 0 to N
   => formula is 0.5 * (1 + t) = 0.5 * (1 + -1 + n * a) = 0.5 * a * n = n / N
   (0..N).each { n -> println "$n -> ${Math.sqrt(n/N)}" }
+
+  Note that for historical reasons, the reverse is the curve read backward (`(N - 1 - n) / N`)
 */
+template <int size>
+inline constexpr XFadeTable<size> kLinearXFadeTable =
+  makeXFadeTable<size>([](int i) { return static_cast<TJBox_Float32>(i) / size; },
+                       [](int i) { return static_cast<TJBox_Float32>(size - 1 - i) / size; });
+
+template <int size>
+class XFade
+{
+public:
+  TJBox_Float64 fXFadeFunction[size];
+
+  /**
+   * @return this curve as a (single precision) table, the reverse curve being the curve read backward (used by the
+   *         buffers `xFade` which then cross fade with an `XFadeCurve`) */
+  XFadeTable<size> toXFadeTable() const
+  {
+    XFadeTable<size> res{};
+    for(int i = 0; i < size; i++)
+      res.fXFadeFunction[i] = static_cast<TJBox_Float32>(fXFadeFunction[i]);
+    res.updateReverseXFadeFunction();
+    return res;
+  }
+};
 
 template <int size>
 class LinearXFade: public XFade<size>
@@ -38,5 +93,82 @@ public:
   }
 };
 
+/**
+ * Same as `XFade` but simply points to a table (so it is cheap to create and copy, and the buffers `xFade` use it
+ * directly instead of converting the curve on every call). The table must outlive this object (which is always the
+ * case for the predefined curves). A default constructed `XFadeCurve` is linear. */
+template <int size>
+class XFadeCurve
+{
+public:
+  constexpr XFadeCurve() : XFadeCurve(kLinearXFadeTable<size>) {}
+
+  constexpr explicit XFadeCurve(XFadeTable<size> const &iTable) :
+    fXFadeFunction{iTable.fXFadeFunction}, fReverseXFadeFunction{iTable.fReverseXFadeFunction} {}
+
+public:
+  TJBox_Float32 const *fXFadeFunction;
+  TJBox_Float32 const *fReverseXFadeFunction;
+};
+
+namespace XFadeImpl {
+
+/**
+ * `constexpr` version of `sin(t * pi / 2)` for `t` in `[0, 1]` (Taylor series, error < 1e-11) */
+constexpr TJBox_Float64 sinHalfPi(TJBox_Float64 t)
+{
+  auto const x = t * 1.57079632679489661923;
+  auto const x2 = x * x;
+  TJBox_Float64 term = x;
+  TJBox_Float64 res = x;
+  for(int n = 1; n <= 7; n++)
+  {
+    term *= -x2 / ((2 * n) * (2 * n + 1));
+    res += term;
+  }
+  return res;
+}
+
+/**
+ * Smoothstep: `3t^2 - 2t^3` */
+constexpr TJBox_Float64 smoothstep(TJBox_Float64 t)
+{
+  return t * t * (3.0 - 2.0 * t);
+}
+
+}
+
+/*
+  cross fade equal power (sin/cos) with t = n / N
+  => xfade = sin(t * pi / 2) and reverse = cos(t * pi / 2) = sin((1 - t) * pi / 2) so xfade^2 + reverse^2 = 1 (no level
+  dip in the middle when cross fading uncorrelated signals)
+*/
+template <int size>
+inline constexpr XFadeTable<size> kEqualPowerXFadeTable =
+  makeXFadeTable<size>([](int i) { return XFadeImpl::sinHalfPi(static_cast<TJBox_Float64>(i) / size); },
+                       [](int i) { return XFadeImpl::sinHalfPi(static_cast<TJBox_Float64>(size - i) / size); });
+
+template <int size>
+class EqualPowerXFade: public XFadeCurve<size>
+{
+public:
+  constexpr EqualPowerXFade() : XFadeCurve<size>(kEqualPowerXFadeTable<size>) {}
+};
+
+/*
+  cross fade "S-curve" (smoothstep) with t = n / N
+  => xfade = 3t^2 - 2t^3 and reverse = smoothstep(1 - t) = 1 - xfade (slope is 0 at both ends)
+*/
+template <int size>
+inline constexpr XFadeTable<size> kSCurveXFadeTable =
+  makeXFadeTable<size>([](int i) { return XFadeImpl::smoothstep(static_cast<TJBox_Float64>(i) / size); },
+                       [](int i) { return XFadeImpl::smoothstep(static_cast<TJBox_Float64>(size - i) / size); });
+
+template <int size>
+class SCurveXFade: public XFadeCurve<size>
+{
+public:
+  constexpr SCurveXFade() : XFadeCurve<size>(kSCurveXFadeTable<size>) {}
+};
 
 #endif //__XFade_H_
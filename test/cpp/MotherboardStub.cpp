@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include "MotherboardStub.h"
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <string>
+
+namespace pongasoft::common::Test::MotherboardStub {
+
+namespace {
+
+enum class EValueType : unsigned char { kNil, kNumber, kBoolean, kDSPBuffer };
+
+struct Object
+{
+  std::string fPath;
+  std::map<std::string, TJBox_Value> fProperties{};
+  std::vector<TJBox_AudioSample> fDSPBuffer{};
+};
+
+std::vector<Object> &objects()
+{
+  static std::vector<Object> kObjects{};
+  return kObjects;
+}
+
+Object &getObject(TJBox_ObjectRef iObjectRef)
+{
+  JBOX_ASSERT(iObjectRef >= 0 && iObjectRef < static_cast<TJBox_ObjectRef>(objects().size()));
+  return objects()[iObjectRef];
+}
+
+// layout of a value: type (byte 0), object ref (bytes 4-7) for a DSP buffer, number (bytes 8-15) otherwise
+TJBox_Value makeValue(EValueType iType, TJBox_Float64 iNumber, TJBox_ObjectRef iObjectRef = 0)
+{
+  static_assert(sizeof(TJBox_Value::fSecret) >= 16, "TJBox_Value too small");
+  TJBox_Value res{};
+  res.fSecret[0] = static_cast<unsigned char>(iType);
+  std::memcpy(res.fSecret + 4, &iObjectRef, sizeof(iObjectRef));
+  std::memcpy(res.fSecret + 8, &iNumber, sizeof(iNumber));
+  return res;
+}
+
+EValueType getType(TJBox_Value const &iValue)
+{
+  return static_cast<EValueType>(iValue.fSecret[0]);
+}
+
+std::vector<TJBox_AudioSample> &getDSPBuffer(TJBox_Value const &iValue, TJBox_AudioFramePos iEndFrame)
+{
+  JBOX_ASSERT(getType(iValue) == EValueType::kDSPBuffer);
+  TJBox_ObjectRef objectRef;
+  std::memcpy(&objectRef, iValue.fSecret + 4, sizeof(objectRef));
+  auto &buffer = getObject(objectRef).fDSPBuffer;
+  if(buffer.size() < static_cast<std::size_t>(iEndFrame))
+    buffer.resize(iEndFrame);
+  return buffer;
+}
+
+}
+
+//------------------------------------------------------------------------
+// getDSPBuffer
+//------------------------------------------------------------------------
+std::vector<TJBox_AudioSample> &getDSPBuffer(char const *iObjectPath)
+{
+  return getObject(JBox_GetMotherboardObjectRef(iObjectPath)).fDSPBuffer;
+}
+
+//------------------------------------------------------------------------
+// makePropertyDiff
+//------------------------------------------------------------------------
+TJBox_PropertyDiff makePropertyDiff(char const *iObjectPath,
+                                    char const *iPropertyName,
+                                    TJBox_Tag iTag,
+                                    TJBox_Value iValue)
+{
+  TJBox_PropertyDiff res{};
+  res.fPropertyRef = JBox_MakePropertyRef(JBox_GetMotherboardObjectRef(iObjectPath), iPropertyName);
+  res.fPreviousValue = JBox_LoadMOMProperty(res.fPropertyRef);
+  res.fCurrentValue = iValue;
+  res.fPropertyTag = iTag;
+  JBox_StoreMOMProperty(res.fPropertyRef, iValue);
+  return res;
+}
+
+//------------------------------------------------------------------------
+// reset
+//------------------------------------------------------------------------
+void reset()
+{
+  objects().clear();
+}
+
+}
+
+using namespace pongasoft::common::Test::MotherboardStub;
+
+TJBox_ObjectRef JBox_GetMotherboardObjectRef(const char *iObjectPath)
+{
+  auto &objs = objects();
+  auto iter = std::find_if(objs.begin(), objs.end(), [iObjectPath](auto const &o) { return o.fPath == iObjectPath; });
+  if(iter != objs.end())
+    return static_cast<TJBox_ObjectRef>(iter - objs.begin());
+  objs.push_back(Object{iObjectPath});
+  return static_cast<TJBox_ObjectRef>(objs.size() - 1);
+}
+
+TJBox_PropertyRef JBox_MakePropertyRef(TJBox_ObjectRef iObject, const char *iKey)
+{
+  TJBox_PropertyRef res{};
+  res.fObject = iObject;
+  std::strncpy(res.fKey, iKey, kJBox_MaxPropertyNameLen);
+  return res;
+}
+
+TJBox_Value JBox_LoadMOMProperty(TJBox_PropertyRef iProperty)
+{
+  auto const &properties = getObject(iProperty.fObject).fProperties;
+  auto iter = properties.find(iProperty.fKey);
+  return iter != properties.end() ? iter->second : makeValue(EValueType::kNil, 0);
+}
+
+TJBox_Value JBox_LoadMOMPropertyByTag(TJBox_ObjectRef iObject, TJBox_Tag iTag)
+{
+  JBOX_ASSERT(iTag == kJBox_AudioInputBuffer || iTag == kJBox_AudioOutputBuffer);
+  return makeValue(EValueType::kDSPBuffer, 0, iObject);
+}
+
+void JBox_StoreMOMProperty(TJBox_PropertyRef iProperty, TJBox_Value iValue)
+{
+  getObject(iProperty.fObject).fProperties[iProperty.fKey] = iValue;
+}
+
+TJBox_Value JBox_MakeNumber(TJBox_Float64 iNumber)
+{
+  return makeValue(EValueType::kNumber, iNumber);
+}
+
+TJBox_Value JBox_MakeBoolean(TJBox_Bool iBoolean)
+{
+  return makeValue(EValueType::kBoolean, iBoolean ? 1.0 : 0.0);
+}
+
+TJBox_Float64 JBox_GetNumber(TJBox_Value iValue)
+{
+  TJBox_Float64 res;
+  std::memcpy(&res, iValue.fSecret + 8, sizeof(res));
+  return res;
+}
+
+TJBox_Bool JBox_GetBoolean(TJBox_Value iValue)
+{
+  return JBox_GetNumber(iValue) != 0;
+}
+
+const void *JBox_GetNativeObjectRO(TJBox_Value)
+{
+  return nullptr;
+}
+
+void *JBox_GetNativeObjectRW(TJBox_Value)
+{
+  return nullptr;
+}
+
+TJBox_Bool JBox_IsReferencingSameProperty(TJBox_PropertyRef iProperty1, TJBox_PropertyRef iProperty2)
+{
+  return iProperty1.fObject == iProperty2.fObject && std::strcmp(iProperty1.fKey, iProperty2.fKey) == 0;
+}
+
+void JBox_GetDSPBufferData(TJBox_Value iValue,
+                           TJBox_AudioFramePos iStartFrame,
+                           TJBox_AudioFramePos iEndFrame,
+                           TJBox_AudioSample oAudio[])
+{
+  auto const &buffer = getDSPBuffer(iValue, iEndFrame);
+  std::copy(buffer.begin() + iStartFrame, buffer.begin() + iEndFrame, oAudio);
+}
+
+void JBox_SetDSPBufferData(TJBox_Value iValue,
+                           TJBox_AudioFramePos iStartFrame,
+                           TJBox_AudioFramePos iEndFrame,
+                           const TJBox_AudioSample iAudio[])
+{
+  auto &buffer = getDSPBuffer(iValue, iEndFrame);
+  std::copy(iAudio, iAudio + (iEndFrame - iStartFrame), buffer.begin() + iStartFrame);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_MotherboardStub_h__
+#define __PongasoftCommon_MotherboardStub_h__
+
+#include <Jukebox.h>
+#include <vector>
+
+/**
+ * In memory implementation of the (subset of the) motherboard API used by re-common so that the classes talking to
+ * the motherboard (ex: sockets, properties) can be exercised in the (native) unit tests. Objects are created on first
+ * access (`JBox_GetMotherboardObjectRef`) and each object owns one DSP buffer which backs both
+ * `kJBox_AudioInputBuffer` and `kJBox_AudioOutputBuffer`. */
+namespace pongasoft::common::Test::MotherboardStub {
+
+/**
+ * @return the DSP buffer of the object at `iObjectPath` (ex: `"/audio_inputs/in1"`) */
+std::vector<TJBox_AudioSample> &getDSPBuffer(char const *iObjectPath);
+
+/**
+ * @return a diff (as provided to `JBoxPropertyManager::onUpdate`) changing the property `iPropertyName` of the object
+ *         at `iObjectPath` to `iValue` */
+TJBox_PropertyDiff makePropertyDiff(char const *iObjectPath,
+                                    char const *iPropertyName,
+                                    TJBox_Tag iTag,
+                                    TJBox_Value iValue);
+
+/**
+ * Removes all objects (and their values) */
+void reset();
+
+}
+
+#endif //__PongasoftCommon_MotherboardStub_h__
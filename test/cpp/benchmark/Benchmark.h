@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#pragma once
+
+#ifndef __PongasoftCommon_Benchmark_h__
+#define __PongasoftCommon_Benchmark_h__
+
+#include <chrono>
+#include <cstdio>
+
+namespace pongasoft::common::Benchmark {
+
+/**
+ * Prevents the compiler from optimizing away a computation whose result is otherwise unused */
+template<typename T>
+inline void doNotOptimize(T const &iValue)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  // the compiler must assume that the (empty) assembly reads the value
+  asm volatile("" : : "g"(&iValue) : "memory");
+#else
+  static volatile T sink;
+  sink = iValue;
+  T const readBack = sink;
+  (void) readBack;
+#endif
+}
+
+/**
+ * Runs `iFunction` `iIterations` times (after a warm up run) and prints the average time per iteration.
+ *
+ * @return the average time per iteration (in nanoseconds) */
+template<typename F>
+double measure(char const *iName, int iIterations, F &&iFunction)
+{
+  iFunction();
+
+  auto start = std::chrono::steady_clock::now();
+  for(int i = 0; i < iIterations; i++)
+    iFunction();
+  auto end = std::chrono::steady_clock::now();
+
+  auto res = std::chrono::duration<double, std::nano>(end - start).count() / iIterations;
+  std::printf("%-50s %12.1f ns\n", iName, res);
+  return res;
+}
+
+}
+
+#endif //__PongasoftCommon_Benchmark_h__
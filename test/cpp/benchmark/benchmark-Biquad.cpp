@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include "Benchmark.h"
+#include <Biquad.h>
+#include <gtest/gtest.h>
+#include <cmath>
+
+namespace pongasoft::common::Benchmark {
+
+namespace benchmark_Biquad {
+
+constexpr int kIterations = 100000;
+constexpr int kStages = 4;
+
+template<int stages>
+void setStages(TBiquadCascade<stages> &oFilter)
+{
+  for(int s = 0; s < stages; s++)
+    oFilter.setStage(s, {EBiquadType::kPeak, 200.0f * (s + 1), 1.0f, 3.0f, 44100});
+}
+
+}
+
+using namespace benchmark_Biquad;
+
+TEST(Benchmark, Biquad)
+{
+  StereoAudioBuffer buffer{};
+  for(int i = 0; i < kBatchSize; i++)
+  {
+    buffer.fLeftAudioBuffer.fAudioBuffer[i] = std::sin(static_cast<TJBox_AudioSample>(i) * 0.1f);
+    buffer.fRightAudioBuffer.fAudioBuffer[i] = std::cos(static_cast<TJBox_AudioSample>(i) * 0.1f);
+  }
+
+  TBiquadCascade<kStages> left{};
+  TBiquadCascade<kStages> right{};
+  setStages(left);
+  setStages(right);
+
+  measure("4 stages (one channel after the other, 1 batch)", kIterations, [&] {
+    left.process(buffer.fLeftAudioBuffer);
+    right.process(buffer.fRightAudioBuffer);
+    doNotOptimize(buffer.fRightAudioBuffer.fAudioBuffer[kBatchSize - 1]);
+  });
+
+  TBiquadCascade<kStages> stereo{};
+  setStages(stereo);
+
+  measure("4 stages (both channels together, 1 batch)", kIterations, [&] {
+    stereo.process(buffer);
+    doNotOptimize(buffer.fRightAudioBuffer.fAudioBuffer[kBatchSize - 1]);
+  });
+
+  TJBox_Float32 frequency = 200;
+  measure("4 stages (both channels together, moving frequency)", kIterations, [&] {
+    frequency = frequency > 5000 ? 200 : frequency * 1.01f;
+    stereo.setStage(0, {EBiquadType::kPeak, frequency, 1.0f, 3.0f, 44100});
+    stereo.process(buffer);
+    doNotOptimize(buffer.fRightAudioBuffer.fAudioBuffer[kBatchSize - 1]);
+  });
+}
+
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include "Benchmark.h"
+#include <CircularBuffer.h>
+#include <Constants.h>
+#include <gtest/gtest.h>
+#include <cmath>
+
+namespace pongasoft::common::Benchmark {
+
+namespace benchmark_CircularBuffer {
+
+constexpr int kSize = 4096;
+constexpr int kIterations = 10000;
+
+// multi tap delay (typical use: reads at several offsets then writes the head)
+template<typename Buffer>
+TJBox_AudioSample multiTap(Buffer &ioBuffer, TJBox_AudioSample const *iInput, TJBox_AudioSample *oOutput)
+{
+  for(int i = 0; i < kBatchSize; i++)
+  {
+    auto const out = ioBuffer.getAt(-1000) * 0.5f + ioBuffer.getAt(-2500) * 0.3f + ioBuffer.getAt(-4000) * 0.2f;
+    ioBuffer.setAt(0, iInput[i] + out * 0.4f);
+    ioBuffer.incrementHead();
+    oOutput[i] = out;
+  }
+  return oOutput[kBatchSize - 1];
+}
+
+}
+
+using namespace benchmark_CircularBuffer;
+
+TEST(Benchmark, CircularBuffer)
+{
+  TJBox_AudioSample input[kBatchSize];
+  TJBox_AudioSample output[kBatchSize];
+  for(int i = 0; i < kBatchSize; i++)
+    input[i] = std::sin(static_cast<TJBox_AudioSample>(i) * 0.3f);
+
+  CircularBuffer<TJBox_AudioSample> buffer{kSize};
+  buffer.init(0);
+  measure("CircularBuffer (3 taps, 1 batch)", kIterations, [&] {
+    doNotOptimize(multiTap(buffer, input, output));
+  });
+
+  TStaticCircularBuffer<TJBox_AudioSample, kSize> staticBuffer{};
+  measure("TStaticCircularBuffer (3 taps, 1 batch)", kIterations, [&] {
+    doNotOptimize(multiTap(staticBuffer, input, output));
+  });
+
+  // simple delay line: element by element vs blocks
+  measure("CircularBuffer (delay, setAt/getAt, 1 batch)", kIterations, [&] {
+    for(int i = 0; i < kBatchSize; i++)
+    {
+      buffer.setAt(0, input[i]);
+      buffer.incrementHead();
+    }
+    for(int i = 0; i < kBatchSize; i++)
+      output[i] = buffer.getAt(-1000 + i);
+    doNotOptimize(output[kBatchSize - 1]);
+  });
+
+  measure("CircularBuffer (delay, writeBlock/readBlock, 1 batch)", kIterations, [&] {
+    buffer.writeBlock(input, kBatchSize);
+    buffer.readBlock(-1000, output, kBatchSize);
+    doNotOptimize(output[kBatchSize - 1]);
+  });
+
+  measure("TStaticCircularBuffer (delay, writeBlock/readBlock, 1 batch)", kIterations, [&] {
+    staticBuffer.writeBlock(input, kBatchSize);
+    staticBuffer.readBlock(-1000, output, kBatchSize);
+    doNotOptimize(output[kBatchSize - 1]);
+  });
+}
+
+}
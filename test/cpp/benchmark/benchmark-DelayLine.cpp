@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include "Benchmark.h"
+#include <DelayLine.h>
+#include <gtest/gtest.h>
+#include <cmath>
+
+namespace pongasoft::common::Benchmark {
+
+namespace benchmark_DelayLine {
+
+constexpr int kSize = 4096;
+constexpr int kIterations = 10000;
+
+// reference: per sample read with getAt (2 wrapped reads per sample)
+TJBox_AudioSample chorusPerSample(TStaticCircularBuffer<TJBox_AudioSample, kSize> &ioBuffer,
+                                  TJBox_AudioSample const *iInput,
+                                  TJBox_Float32 const *iDelays,
+                                  TJBox_AudioSample *oOutput)
+{
+  for(int i = 0; i < kBatchSize; i++)
+  {
+    ioBuffer.setAt(0, iInput[i]);
+    ioBuffer.incrementHead();
+    auto const position = -1.0f - iDelays[i];
+    auto const p0 = static_cast<int>(std::floor(position));
+    auto const f = position - static_cast<TJBox_Float32>(p0);
+    auto const x0 = ioBuffer.getAt(p0);
+    oOutput[i] = x0 + f * (ioBuffer.getAt(p0 + 1) - x0);
+  }
+  return oOutput[kBatchSize - 1];
+}
+
+}
+
+using namespace benchmark_DelayLine;
+
+TEST(Benchmark, DelayLine)
+{
+  TJBox_AudioSample input[kBatchSize];
+  TJBox_AudioSample output[kBatchSize];
+  TJBox_Float32 delays[kBatchSize];
+  for(int i = 0; i < kBatchSize; i++)
+  {
+    input[i] = std::sin(static_cast<TJBox_AudioSample>(i) * 0.3f);
+    delays[i] = 1000.0f + 20.0f * std::sin(static_cast<TJBox_Float32>(i) * 0.01f);
+  }
+
+  TStaticCircularBuffer<TJBox_AudioSample, kSize> buffer{};
+  measure("Chorus (linear, getAt per sample, 1 batch)", kIterations, [&] {
+    doNotOptimize(chorusPerSample(buffer, input, delays, output));
+  });
+
+  for(auto interpolation: {EDelayInterpolation::kLinear, EDelayInterpolation::kHermite, EDelayInterpolation::kAllPass})
+  {
+    TDelayLine<kSize> delayLine{interpolation};
+    auto const name = interpolation == EDelayInterpolation::kLinear ? "TDelayLine (linear, 1 batch)" :
+                      interpolation == EDelayInterpolation::kHermite ? "TDelayLine (hermite, 1 batch)" :
+                      "TDelayLine (all pass, 1 batch)";
+    measure(name, kIterations, [&] {
+      delayLine.write(input);
+      delayLine.read(delays, output);
+      doNotOptimize(output[kBatchSize - 1]);
+    });
+  }
+}
+
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include "Benchmark.h"
+#include <Denormals.h>
+#include <CircularBuffer.h>
+#include <AudioBuffer.h>
+#include <gtest/gtest.h>
+
+namespace pongasoft::common::Benchmark {
+
+namespace benchmark_Denormals {
+
+/**
+ * Feedback delay (the typical structure built on `CircularBuffer`) processing silence: the content decays into the
+ * denormal range and, with a feedback close to 1, stays there forever (`x * 0.99` rounds back to `x`) */
+class FeedbackDelay
+{
+public:
+  explicit FeedbackDelay(bool iFlushDenormals) : fDelay{kDelaySize}, fFlushDenormals{iFlushDenormals}
+  {
+    fDelay.init(std::numeric_limits<TJBox_AudioSample>::denorm_min() * 100);
+  }
+
+  void process(AudioBuffer &ioBuffer)
+  {
+    for(auto &sample: ioBuffer.fAudioBuffer)
+    {
+      auto out = fDelay.getAt(0);
+      auto in = sample + out * 0.99f;
+      fDelay.setAt(0, fFlushDenormals ? dsp::flushDenormal(in) : in);
+      fDelay.incrementHead();
+      sample = out;
+    }
+  }
+
+private:
+  static constexpr int kDelaySize = 441;
+
+  CircularBuffer<TJBox_AudioSample> fDelay;
+  bool fFlushDenormals;
+};
+
+constexpr int kIterations = 10000;
+
+}
+
+using namespace benchmark_Denormals;
+
+TEST(Benchmark, Denormals)
+{
+  AudioBuffer silence{};
+
+  FeedbackDelay noProtection{false};
+  measure("FeedbackDelay (no protection)", kIterations, [&] {
+    silence.clear();
+    noProtection.process(silence);
+  });
+
+  FeedbackDelay scoped{false};
+  measure("FeedbackDelay (ScopedFlushDenormals)", kIterations, [&] {
+    dsp::ScopedFlushDenormals flushDenormals{};
+    silence.clear();
+    scoped.process(silence);
+  });
+
+  FeedbackDelay flushed{true};
+  measure("FeedbackDelay (flushDenormal on feedback)", kIterations, [&] {
+    silence.clear();
+    flushed.process(silence);
+  });
+
+  AudioBuffer denormals{};
+  measure("AudioBuffer::flushDenormals", kIterations, [&] {
+    std::fill(std::begin(denormals.fAudioBuffer), std::end(denormals.fAudioBuffer), 1e-40f);
+    denormals.flushDenormals();
+    doNotOptimize(denormals.fAudioBuffer[0]);
+  });
+}
+
+}
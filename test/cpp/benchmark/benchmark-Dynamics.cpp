@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include "Benchmark.h"
+#include <Dynamics.h>
+#include <gtest/gtest.h>
+#include <cmath>
+
+namespace pongasoft::common::Benchmark {
+
+namespace benchmark_Dynamics {
+
+constexpr int kIterations = 100000;
+
+}
+
+using namespace benchmark_Dynamics;
+
+TEST(Benchmark, Dynamics)
+{
+  Utils::SampleRateBasedClock clock{44100};
+  DynamicsParameters parameters{};
+
+  AudioBuffer sidechain{};
+  for(int i = 0; i < kBatchSize; i++)
+    sidechain.fAudioBuffer[i] = std::sin(static_cast<TJBox_AudioSample>(i) * 0.3f);
+
+  TJBox_Float32 gains[kBatchSize];
+
+  // typical per device implementation: std::log10/std::pow per sample
+  auto const attack = static_cast<TJBox_Float32>(std::exp(-1.0 / (parameters.fAttackMs * 44.1)));
+  auto const release = static_cast<TJBox_Float32>(std::exp(-1.0 / (parameters.fReleaseMs * 44.1)));
+  TJBox_Float32 gr = 0;
+  measure("std::log10/std::pow (1 batch)", kIterations, [&] {
+    for(int i = 0; i < kBatchSize; i++)
+    {
+      auto const levelDb = 20.0f * std::log10(std::max(std::abs(sidechain.fAudioBuffer[i]), 1e-6f));
+      auto const target = Dynamics::computeGainReductionDb(parameters, levelDb);
+      auto const coefficient = target < gr ? attack : release;
+      gr = target + coefficient * (gr - target);
+      gains[i] = std::pow(10.0f, (gr + parameters.fMakeupDb) / 20.0f);
+    }
+    doNotOptimize(gains[kBatchSize - 1]);
+  });
+
+  Dynamics peak{clock, parameters};
+  measure("Dynamics peak (1 batch)", kIterations, [&] {
+    peak.process(sidechain, gains);
+    doNotOptimize(gains[kBatchSize - 1]);
+  });
+
+  parameters.fDetector = EDynamicsDetector::kRms;
+  Dynamics rms{clock, parameters};
+  measure("Dynamics rms (1 batch)", kIterations, [&] {
+    rms.process(sidechain, gains);
+    doNotOptimize(gains[kBatchSize - 1]);
+  });
+}
+
+}
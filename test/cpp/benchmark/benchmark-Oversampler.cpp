@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include "Benchmark.h"
+#include <Oversampler.h>
+#include <gtest/gtest.h>
+#include <cmath>
+
+namespace pongasoft::common::Benchmark {
+
+namespace benchmark_Oversampler {
+
+constexpr int kIterations = 100000;
+
+// Straightforward implementation: zero stuffing and the full (47 taps) filter at the high rate, computing all the
+// samples (even the ones dropped when decimating)
+class NaiveOversampler2x
+{
+public:
+  static constexpr int kTapCount = 4 * OversamplerImpl::kStage1HalfLength - 1;
+
+  NaiveOversampler2x()
+  {
+    auto const &table = OversamplerImpl::kHalfbandTable<OversamplerImpl::kStage1HalfLength>.fValues;
+    for(int i = 0; i < kTapCount; i++)
+      fTaps[i] = i % 2 == 0 ? table[i / 2] : (i == kTapCount / 2 ? 0.5f : 0.0f);
+  }
+
+  template<typename Kernel>
+  void process(TJBox_AudioSample *ioSamples, Kernel &&iKernel)
+  {
+    TJBox_AudioSample stuffed[2 * kBatchSize];
+    for(int i = 0; i < kBatchSize; i++)
+    {
+      stuffed[2 * i] = 2.0f * ioSamples[i];
+      stuffed[2 * i + 1] = 0;
+    }
+    filter(fUpHistory, stuffed);
+    iKernel(stuffed, 2 * kBatchSize);
+    filter(fDownHistory, stuffed);
+    for(int i = 0; i < kBatchSize; i++)
+      ioSamples[i] = stuffed[2 * i];
+  }
+
+private:
+  void filter(TJBox_AudioSample *ioHistory, TJBox_AudioSample *ioSamples)
+  {
+    std::copy(ioSamples, ioSamples + 2 * kBatchSize, ioHistory + kTapCount - 1);
+    for(int n = 0; n < 2 * kBatchSize; n++)
+    {
+      TJBox_AudioSample y = 0;
+      for(int i = 0; i < kTapCount; i++)
+        y += fTaps[i] * ioHistory[n + i];
+      ioSamples[n] = y;
+    }
+    std::copy(ioHistory + 2 * kBatchSize, ioHistory + 2 * kBatchSize + kTapCount - 1, ioHistory);
+  }
+
+private:
+  TJBox_Float32 fTaps[kTapCount]{};
+  TJBox_AudioSample fUpHistory[kTapCount - 1 + 2 * kBatchSize]{};
+  TJBox_AudioSample fDownHistory[kTapCount - 1 + 2 * kBatchSize]{};
+};
+
+}
+
+using namespace benchmark_Oversampler;
+
+TEST(Benchmark, Oversampler)
+{
+  AudioBuffer buffer{};
+  for(int i = 0; i < kBatchSize; i++)
+    buffer.fAudioBuffer[i] = std::sin(static_cast<TJBox_AudioSample>(i) * 0.3f);
+
+  auto const kernel = [](TJBox_AudioSample *ioSamples, int iCount) { dsp::softClip(ioSamples, 2.0f, 1.0f, iCount); };
+
+  NaiveOversampler2x naive{};
+  measure("naive FIR 2x (1 batch)", kIterations, [&] {
+    naive.process(buffer.fAudioBuffer, kernel);
+    doNotOptimize(buffer.fAudioBuffer[kBatchSize - 1]);
+  });
+
+  Oversampler2x oversampler2x{};
+  measure("polyphase halfband 2x (1 batch)", kIterations, [&] {
+    oversampler2x.process(buffer, kernel);
+    doNotOptimize(buffer.fAudioBuffer[kBatchSize - 1]);
+  });
+
+  Oversampler4x oversampler4x{};
+  measure("polyphase halfband 4x (1 batch)", kIterations, [&] {
+    oversampler4x.process(buffer, kernel);
+    doNotOptimize(buffer.fAudioBuffer[kBatchSize - 1]);
+  });
+}
+
+}
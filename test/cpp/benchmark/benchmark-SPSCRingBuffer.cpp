@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include "Benchmark.h"
+#include <SPSCRingBuffer.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace pongasoft::common::Benchmark {
+
+namespace benchmark_SPSCRingBuffer {
+
+constexpr int kBatches = 1000;
+constexpr int kIterations = 20;
+
+using Ring = TSPSCRingBuffer<TJBox_AudioSample, 16 * kBatchSize>;
+
+// consumer thread: pops (and sums, like an analysis would) kBatches batches
+TJBox_AudioSample consume(Ring &ioRing)
+{
+  AudioBuffer buffer{};
+  TJBox_AudioSample sum = 0;
+  for(int b = 0; b < kBatches;)
+  {
+    if(ioRing.pop(buffer))
+    {
+      sum += buffer.fAudioBuffer[0];
+      b++;
+    }
+    else
+      std::this_thread::yield();
+  }
+  return sum;
+}
+
+// render loop (producer) handing off kBatches batches to each ring (one per consumer thread)
+void stream(std::vector<std::unique_ptr<Ring>> &ioRings, AudioBuffer const &iInput)
+{
+  std::vector<std::thread> consumers{};
+  std::vector<TJBox_AudioSample> sums(ioRings.size());
+  for(size_t c = 0; c < ioRings.size(); c++)
+    consumers.emplace_back([&ioRings, &sums, c] { sums[c] = consume(*ioRings[c]); });
+
+  for(int b = 0; b < kBatches; b++)
+  {
+    for(auto &ring: ioRings)
+    {
+      while(!ring->push(iInput))
+        std::this_thread::yield();
+    }
+  }
+
+  for(auto &consumer: consumers)
+    consumer.join();
+  doNotOptimize(sums[0]);
+}
+
+}
+
+using namespace benchmark_SPSCRingBuffer;
+
+TEST(Benchmark, SPSCRingBuffer)
+{
+  AudioBuffer input{};
+  for(int i = 0; i < kBatchSize; i++)
+    input.fAudioBuffer[i] = std::sin(static_cast<TJBox_AudioSample>(i) * 0.3f);
+
+  // single thread (no contention): cost of the hand off itself
+  Ring ring{};
+  AudioBuffer output{};
+  measure("TSPSCRingBuffer (push/pop, 1 batch)", kIterations * kBatches, [&] {
+    ring.push(input);
+    ring.pop(output);
+    doNotOptimize(output.fAudioBuffer[0]);
+  });
+
+  for(int consumers: {1, 4})
+  {
+    std::vector<std::unique_ptr<Ring>> rings{};
+    for(int c = 0; c < consumers; c++)
+      rings.emplace_back(std::make_unique<Ring>());
+    measure(consumers == 1 ? "TSPSCRingBuffer (1 consumer, 1000 batches)" : "TSPSCRingBuffer (4 consumers, 1000 batches)",
+            kIterations, [&] { stream(rings, input); });
+  }
+}
+
+}
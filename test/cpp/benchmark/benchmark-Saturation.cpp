@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include "Benchmark.h"
+#include <DSPKernels.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+namespace pongasoft::common::Benchmark {
+
+namespace benchmark_Saturation {
+
+constexpr int kCount = 1024;
+constexpr int kIterations = 10000;
+
+}
+
+using namespace benchmark_Saturation;
+
+TEST(Benchmark, Saturation)
+{
+  std::vector<TJBox_AudioSample> src(kCount);
+  for(int i = 0; i < kCount; i++)
+    src[i] = 2.0f * std::sin(static_cast<TJBox_AudioSample>(i) * 0.05f);
+
+  std::vector<TJBox_AudioSample> res(kCount);
+
+  measure("std::tanh (1024 samples)", kIterations, [&] {
+    for(int i = 0; i < kCount; i++)
+      res[i] = std::tanh(src[i] * 2.0f);
+    doNotOptimize(res[kCount - 1]);
+  });
+
+  measure("softClip (1024 samples)", kIterations, [&] {
+    std::copy(src.begin(), src.end(), res.begin());
+    dsp::softClip(res.data(), 2.0f, 1.0f, kCount);
+    doNotOptimize(res[kCount - 1]);
+  });
+
+  measure("softClip with mix (1024 samples)", kIterations, [&] {
+    std::copy(src.begin(), src.end(), res.begin());
+    dsp::softClip(res.data(), 2.0f, 0.5f, kCount);
+    doNotOptimize(res[kCount - 1]);
+  });
+
+  measure("asymmetricClip (1024 samples)", kIterations, [&] {
+    std::copy(src.begin(), src.end(), res.begin());
+    dsp::asymmetricClip(res.data(), 2.0f, 0.3f, 1.0f, kCount);
+    doNotOptimize(res[kCount - 1]);
+  });
+
+  measure("hardClip (1024 samples)", kIterations, [&] {
+    std::copy(src.begin(), src.end(), res.begin());
+    dsp::hardClip(res.data(), 2.0f, 1.0f, kCount);
+    doNotOptimize(res[kCount - 1]);
+  });
+}
+
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include "Benchmark.h"
+#include <SlidingWindow.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+
+namespace pongasoft::common::Benchmark {
+
+namespace benchmark_SlidingWindow {
+
+constexpr int kSize = 10000;
+constexpr int kIterations = 1000;
+
+}
+
+using namespace benchmark_SlidingWindow;
+
+// mean/min/max of the last 10000 values, queried every batch
+TEST(Benchmark, SlidingWindow)
+{
+  AudioBuffer input{};
+  for(int i = 0; i < kBatchSize; i++)
+    input.fAudioBuffer[i] = std::sin(static_cast<TJBox_AudioSample>(i) * 0.3f);
+
+  CircularBuffer<TJBox_AudioSample> history{kSize};
+  history.init(0);
+  auto sum = [](TJBox_AudioSample a, TJBox_AudioSample b) { return a + b; };
+  auto min = [](TJBox_AudioSample a, TJBox_AudioSample b) { return std::min(a, b); };
+  auto max = [](TJBox_AudioSample a, TJBox_AudioSample b) { return std::max(a, b); };
+  measure("CircularBuffer (fold x 3, 1 batch)", kIterations, [&] {
+    history.writeBlock(input);
+    doNotOptimize(history.fold(1, kSize, history.getAt(0), sum) / kSize);
+    doNotOptimize(history.fold(1, kSize, history.getAt(0), min));
+    doNotOptimize(history.fold(1, kSize, history.getAt(0), max));
+  });
+
+  SlidingWindow<TJBox_AudioSample> window{kSize};
+  measure("SlidingWindow (mean/min/max, 1 batch)", kIterations, [&] {
+    window.push(input);
+    doNotOptimize(window.getMean());
+    doNotOptimize(window.getMin());
+    doNotOptimize(window.getMax());
+  });
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include "Benchmark.h"
+#include <Volume.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace pongasoft::common::Benchmark {
+
+namespace benchmark_Volume {
+
+constexpr int kCount = 1024;
+constexpr int kIterations = 10000;
+
+}
+
+using namespace benchmark_Volume;
+
+TEST(Benchmark, Volume)
+{
+  std::vector<TJBox_Float32> volumes(kCount);
+  for(int i = 0; i < kCount; i++)
+    volumes[i] = static_cast<TJBox_Float32>(i) / kCount;
+
+  std::vector<TJBox_Float32> gains(kCount);
+  std::vector<TJBox_Float32> res(kCount);
+
+  // previous implementation
+  measure("toVolumeCube (divide, 1024 values)", kIterations, [&] {
+    for(int i = 0; i < kCount; i++)
+    {
+      if(std::fabs(volumes[i] - 0.7f) < 1e-5)
+        gains[i] = Volume_Init_Value;
+      else
+      {
+        auto const correctedVolume = volumes[i] / 0.7f;
+        gains[i] = correctedVolume * correctedVolume * correctedVolume;
+      }
+    }
+    doNotOptimize(gains[kCount - 1]);
+  });
+
+  measure("toVolumeCube (buffer, 1024 values)", kIterations, [&] {
+    toVolumeCube(volumes.data(), gains.data(), kCount);
+    doNotOptimize(gains[kCount - 1]);
+  });
+
+  // previous implementation
+  measure("fromVolumeCube (std::pow, 1024 values)", kIterations, [&] {
+    for(int i = 0; i < kCount; i++)
+      res[i] = static_cast<TJBox_Float32>(std::pow(gains[i], 1.0 / 3) * 0.7f);
+    doNotOptimize(res[kCount - 1]);
+  });
+
+  measure("fromVolumeCube (fastCbrt, 1024 values)", kIterations, [&] {
+    fromVolumeCube(gains.data(), res.data(), kCount);
+    doNotOptimize(res[kCount - 1]);
+  });
+}
+
+}
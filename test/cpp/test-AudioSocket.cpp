@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <AudioSocket.h>
+#include <JBoxPropertyManager.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "MotherboardStub.h"
+
+namespace pongasoft::common::Test {
+
+// TMultiChannelInSockets
+TEST(AudioSocket, TMultiChannelInSockets)
+{
+  MotherboardStub::reset();
+
+  TMultiChannelInSockets<3> sockets{{"in1", "in2", "in3"}};
+  char const *paths[] = {"/audio_inputs/in1", "/audio_inputs/in2", "/audio_inputs/in3"};
+
+  for(int c = 0; c < 3; c++)
+  {
+    auto &dsp = MotherboardStub::getDSPBuffer(paths[c]);
+    dsp.resize(kBatchSize);
+    for(int i = 0; i < kBatchSize; i++)
+      dsp[i] = static_cast<TJBox_AudioSample>(c * kBatchSize + i) / (3 * kBatchSize);
+  }
+
+  MultiChannelAudioBuffer<3> buffer{};
+  buffer.clear();
+  sockets.readAudio(buffer);
+
+  for(int c = 0; c < 3; c++)
+  {
+    auto const &dsp = MotherboardStub::getDSPBuffer(paths[c]);
+    ASSERT_TRUE(std::equal(dsp.begin(), dsp.end(), buffer.getChannel(c).fAudioBuffer)) << "channel=" << c;
+  }
+
+  // connected as soon as one socket is connected
+  JBoxPropertyManager manager{};
+  sockets.registerForUpdate(manager);
+  TJBox_PropertyDiff diffs[3];
+  for(int c = 0; c < 3; c++)
+  {
+    diffs[c] = MotherboardStub::makePropertyDiff(paths[c], "connected", kJBox_AudioInputConnected,
+                                                 JBox_MakeBoolean(false));
+  }
+  manager.onUpdate(diffs, 3);
+  ASSERT_FALSE(sockets.isConnected());
+
+  auto diff = MotherboardStub::makePropertyDiff(paths[1], "connected", kJBox_AudioInputConnected,
+                                                JBox_MakeBoolean(true));
+  manager.onUpdate(&diff, 1);
+  ASSERT_TRUE(sockets.isConnected());
+  ASSERT_FALSE(sockets.getSocket(0).isConnected());
+  ASSERT_TRUE(sockets.getSocket(1).isConnected());
+}
+
+// TMultiChannelOutSockets
+TEST(AudioSocket, TMultiChannelOutSockets)
+{
+  MotherboardStub::reset();
+
+  TMultiChannelOutSockets<3> sockets{{"out1", "out2", "out3"}};
+  char const *paths[] = {"/audio_outputs/out1", "/audio_outputs/out2", "/audio_outputs/out3"};
+
+  MultiChannelAudioBuffer<3> buffer{};
+  for(int i = 0; i < 3 * kBatchSize; i++)
+    buffer.data()[i] = static_cast<TJBox_AudioSample>(i) / (3 * kBatchSize);
+
+  sockets.writeAudio(buffer);
+
+  for(int c = 0; c < 3; c++)
+  {
+    auto const &dsp = MotherboardStub::getDSPBuffer(paths[c]);
+    ASSERT_EQ(kBatchSize, static_cast<int>(dsp.size())) << "channel=" << c;
+    ASSERT_TRUE(std::equal(dsp.begin(), dsp.end(), buffer.getChannel(c).fAudioBuffer)) << "channel=" << c;
+  }
+
+  // silent channels are not written
+  for(auto path: paths)
+    MotherboardStub::getDSPBuffer(path).clear();
+  buffer.getChannel(0).clear();
+  buffer.getChannel(2).clear();
+  ASSERT_TRUE(sockets.maybeWriteAudio(buffer));
+  ASSERT_TRUE(MotherboardStub::getDSPBuffer(paths[0]).empty());
+  ASSERT_TRUE(std::equal(MotherboardStub::getDSPBuffer(paths[1]).begin(),
+                         MotherboardStub::getDSPBuffer(paths[1]).end(),
+                         buffer.getChannel(1).fAudioBuffer));
+  ASSERT_TRUE(MotherboardStub::getDSPBuffer(paths[2]).empty());
+
+  buffer.clear();
+  ASSERT_FALSE(sockets.maybeWriteAudio(buffer));
+
+  // connected as soon as one socket is connected
+  JBoxPropertyManager manager{};
+  sockets.registerForUpdate(manager);
+  TJBox_PropertyDiff diffs[3];
+  for(int c = 0; c < 3; c++)
+  {
+    diffs[c] = MotherboardStub::makePropertyDiff(paths[c], "connected", kJBox_AudioOutputConnected,
+                                                 JBox_MakeBoolean(false));
+  }
+  manager.onUpdate(diffs, 3);
+  ASSERT_FALSE(sockets.isConnected());
+
+  auto diff = MotherboardStub::makePropertyDiff(paths[2], "connected", kJBox_AudioOutputConnected,
+                                                JBox_MakeBoolean(true));
+  manager.onUpdate(&diff, 1);
+  ASSERT_TRUE(sockets.isConnected());
+  ASSERT_TRUE(sockets.getSocket(2).isConnected());
+}
+
+}
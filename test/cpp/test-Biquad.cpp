@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <Biquad.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+namespace pongasoft::common::Test {
+
+namespace test_Biquad {
+
+// |H(e^jw)| in dB
+TJBox_Float64 magnitudeDb(BiquadCoefficients const &c, TJBox_Float64 iFrequency, int iSampleRate)
+{
+  auto const z = std::polar(1.0, -2.0 * kPi * iFrequency / iSampleRate); // z^-1
+  TJBox_Float64 const b0 = c.fB0, b1 = c.fB1, b2 = c.fB2, a1 = c.fA1, a2 = c.fA2;
+  auto const h = (b0 + b1 * z + b2 * z * z) / (1.0 + a1 * z + a2 * z * z);
+  return 20.0 * std::log10(std::abs(h));
+}
+
+// direct form I in double precision
+std::vector<TJBox_Float64> reference(BiquadCoefficients const &c, std::vector<TJBox_AudioSample> const &iInput)
+{
+  std::vector<TJBox_Float64> res(iInput.size());
+  TJBox_Float64 x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+  for(size_t i = 0; i < iInput.size(); i++)
+  {
+    auto const x = static_cast<TJBox_Float64>(iInput[i]);
+    auto const y = c.fB0 * x + c.fB1 * x1 + c.fB2 * x2 - c.fA1 * y1 - c.fA2 * y2;
+    x2 = x1; x1 = x;
+    y2 = y1; y1 = y;
+    res[i] = y;
+  }
+  return res;
+}
+
+std::vector<TJBox_AudioSample> noise(int iCount, unsigned int iSeed)
+{
+  std::mt19937 generator{iSeed};
+  std::uniform_real_distribution<TJBox_AudioSample> distribution{-1.0f, 1.0f};
+  std::vector<TJBox_AudioSample> res(iCount);
+  for(auto &s: res)
+    s = distribution(generator);
+  return res;
+}
+
+}
+
+using namespace test_Biquad;
+
+// Frequency response of the designs
+TEST(Biquad, Design)
+{
+  constexpr int sampleRate = 48000;
+
+  auto lp = BiquadImpl::design({EBiquadType::kLowPass, 1000, 0.707106781f, 0, sampleRate});
+  ASSERT_NEAR(0, magnitudeDb(lp, 10, sampleRate), 1e-3);
+  ASSERT_NEAR(-3.0103, magnitudeDb(lp, 1000, sampleRate), 1e-2);
+  ASSERT_LT(magnitudeDb(lp, 10000, sampleRate), -35);
+
+  auto hp = BiquadImpl::design({EBiquadType::kHighPass, 1000, 0.707106781f, 0, sampleRate});
+  ASSERT_NEAR(0, magnitudeDb(hp, 20000, sampleRate), 1e-2);
+  ASSERT_NEAR(-3.0103, magnitudeDb(hp, 1000, sampleRate), 1e-2);
+  ASSERT_LT(magnitudeDb(hp, 100, sampleRate), -35);
+
+  auto bp = BiquadImpl::design({EBiquadType::kBandPass, 2000, 2, 0, sampleRate});
+  ASSERT_NEAR(0, magnitudeDb(bp, 2000, sampleRate), 1e-3);
+
+  auto notch = BiquadImpl::design({EBiquadType::kNotch, 2000, 2, 0, sampleRate});
+  ASSERT_LT(magnitudeDb(notch, 2000, sampleRate), -60);
+
+  auto ap = BiquadImpl::design({EBiquadType::kAllPass, 2000, 2, 0, sampleRate});
+  for(auto f: {100, 2000, 15000})
+    ASSERT_NEAR(0, magnitudeDb(ap, f, sampleRate), 1e-4);
+
+  auto peak = BiquadImpl::design({EBiquadType::kPeak, 3000, 1, 6, sampleRate});
+  ASSERT_NEAR(6, magnitudeDb(peak, 3000, sampleRate), 1e-3);
+  ASSERT_NEAR(0, magnitudeDb(peak, 20, sampleRate), 1e-2);
+
+  auto lowShelf = BiquadImpl::design({EBiquadType::kLowShelf, 200, 0.707106781f, -12, sampleRate});
+  ASSERT_NEAR(-12, magnitudeDb(lowShelf, 10, sampleRate), 1e-2);
+  ASSERT_NEAR(0, magnitudeDb(lowShelf, 20000, sampleRate), 1e-2);
+
+  auto highShelf = BiquadImpl::design({EBiquadType::kHighShelf, 5000, 0.707106781f, 4, sampleRate});
+  ASSERT_NEAR(0, magnitudeDb(highShelf, 10, sampleRate), 1e-2);
+  ASSERT_NEAR(4, magnitudeDb(highShelf, 23000, sampleRate), 5e-2);
+
+  // cache
+  BiquadDesigner designer{};
+  auto const &c = designer.design({EBiquadType::kPeak, 3000, 1, 6, sampleRate});
+  ASSERT_EQ(peak, c);
+  ASSERT_EQ(&c, &designer.design({EBiquadType::kPeak, 3000, 1, 6, sampleRate}));
+  ASSERT_EQ(lp, designer.design({EBiquadType::kLowPass, 1000, 0.707106781f, 0, sampleRate}));
+}
+
+// Processing matches the reference (mono, stereo and cascade)
+TEST(Biquad, Process)
+{
+  constexpr int sampleRate = 44100;
+  constexpr int batches = 20;
+
+  BiquadParameters const params[] = {
+    {EBiquadType::kLowPass, 500, 0.707106781f, 0, sampleRate},
+    {EBiquadType::kPeak, 2500, 3, -9, sampleRate}
+  };
+
+  auto const left = noise(batches * kBatchSize, 1);
+  auto const right = noise(batches * kBatchSize, 2);
+
+  // expected: one stage after the other (independent of batch boundaries)
+  auto expectedLeft = reference(BiquadImpl::design(params[0]), left);
+  auto expectedRight = reference(BiquadImpl::design(params[0]), right);
+  std::vector<TJBox_AudioSample> tmp(expectedLeft.begin(), expectedLeft.end());
+  expectedLeft = reference(BiquadImpl::design(params[1]), tmp);
+  tmp.assign(expectedRight.begin(), expectedRight.end());
+  expectedRight = reference(BiquadImpl::design(params[1]), tmp);
+
+  TBiquadCascade<2> mono{};
+  TBiquadCascade<2> stereo{};
+  for(int s = 0; s < 2; s++)
+  {
+    mono.setStage(s, params[s]);
+    stereo.setStage(s, params[s]);
+  }
+
+  AudioBuffer monoBuffer{};
+  StereoAudioBuffer stereoBuffer{};
+  for(int b = 0; b < batches; b++)
+  {
+    auto const offset = b * kBatchSize;
+    std::copy(left.begin() + offset, left.begin() + offset + kBatchSize, monoBuffer.fAudioBuffer);
+    std::copy(left.begin() + offset, left.begin() + offset + kBatchSize, stereoBuffer.fLeftAudioBuffer.fAudioBuffer);
+    std::copy(right.begin() + offset, right.begin() + offset + kBatchSize, stereoBuffer.fRightAudioBuffer.fAudioBuffer);
+
+    mono.process(monoBuffer);
+    stereo.process(stereoBuffer);
+
+    for(int i = 0; i < kBatchSize; i++)
+    {
+      ASSERT_NEAR(expectedLeft[offset + i], monoBuffer.fAudioBuffer[i], 1e-5) << b << "/" << i;
+      ASSERT_NEAR(expectedLeft[offset + i], stereoBuffer.fLeftAudioBuffer.fAudioBuffer[i], 1e-5) << b << "/" << i;
+      ASSERT_NEAR(expectedRight[offset + i], stereoBuffer.fRightAudioBuffer.fAudioBuffer[i], 1e-5) << b << "/" << i;
+    }
+  }
+
+  // reset clears the state
+  stereo.reset();
+  stereoBuffer.clear();
+  stereo.process(stereoBuffer);
+  ASSERT_EQ(0, stereoBuffer.max());
+}
+
+// Coefficients are interpolated over one batch when they change
+TEST(Biquad, Smoothing)
+{
+  constexpr int sampleRate = 44100;
+
+  Biquad filter{};
+  BiquadParameters params{EBiquadType::kLowPass, 1000, 0.707106781f, 0, sampleRate};
+  filter.setStage(0, params);
+  auto const from = filter.getCoefficients(0);
+
+  // DC goes through a low pass
+  AudioBuffer buffer{};
+  for(int b = 0; b < 200; b++)
+  {
+    std::fill(std::begin(buffer.fAudioBuffer), std::end(buffer.fAudioBuffer), 1.0f);
+    filter.process(buffer);
+  }
+  ASSERT_NEAR(1.0f, buffer.fAudioBuffer[kBatchSize - 1], 1e-4f);
+
+  params.fFrequency = 1500;
+  filter.setStage(0, params);
+  auto const to = BiquadImpl::design(params);
+  ASSERT_EQ(from, filter.getCoefficients(0)); // not yet applied
+
+  // same with the coefficients switched without interpolation
+  BiquadImpl::State state{};
+  TJBox_AudioSample dc[kBatchSize];
+  for(int b = 0; b < 200; b++)
+  {
+    std::fill(std::begin(dc), std::end(dc), 1.0f);
+    BiquadImpl::process(from, state, dc, kBatchSize);
+  }
+  std::fill(std::begin(dc), std::end(dc), 1.0f);
+  BiquadImpl::process(to, state, dc, kBatchSize);
+
+  // still DC (both filters have a unity DC gain): the transient is a lot smaller than when switching abruptly
+  std::fill(std::begin(buffer.fAudioBuffer), std::end(buffer.fAudioBuffer), 1.0f);
+  filter.process(buffer);
+  ASSERT_EQ(to, filter.getCoefficients(0));
+  TJBox_Float32 maxDeviation = 0, maxAbruptDeviation = 0;
+  for(int i = 0; i < kBatchSize; i++)
+  {
+    maxDeviation = std::max(maxDeviation, std::abs(buffer.fAudioBuffer[i] - 1.0f));
+    maxAbruptDeviation = std::max(maxAbruptDeviation, std::abs(dc[i] - 1.0f));
+  }
+  ASSERT_LT(maxDeviation * 3, maxAbruptDeviation);
+}
+
+}
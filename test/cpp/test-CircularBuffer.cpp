@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <AudioBuffer.h>
+#include <CircularBuffer.h>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace pongasoft::common::Test {
+
+namespace test_CircularBuffer {
+
+// writeBlock / readBlock are the same as the element by element versions
+template<typename Buffer>
+void testBlocks(Buffer &ioBuffer)
+{
+  auto const size = ioBuffer.getSize();
+  CircularBuffer<int> expected{size};
+  expected.init(0);
+  ioBuffer.init(0);
+
+  std::mt19937 generator{2};
+  // including more than the size of the buffer
+  std::uniform_int_distribution<int> counts{0, 3 * size};
+  std::uniform_int_distribution<int> offsets{-2 * size, size};
+  int value = 0;
+  for(int i = 0; i < 1000; i++)
+  {
+    std::vector<int> block(counts(generator));
+    for(auto &v: block)
+      v = ++value;
+
+    for(auto v: block)
+    {
+      expected.setAt(0, v);
+      expected.incrementHead();
+    }
+    ioBuffer.writeBlock(block.data(), static_cast<int>(block.size()));
+    ASSERT_EQ(expected.getAt(-1), ioBuffer.getAt(-1));
+
+    auto const offset = offsets(generator);
+    std::vector<int> actual(counts(generator));
+    ioBuffer.readBlock(offset, actual.data(), static_cast<int>(actual.size()));
+    for(int k = 0; k < static_cast<int>(actual.size()); k++)
+      ASSERT_EQ(expected.getAt(offset + k), actual[k]) << i << "/" << k;
+  }
+}
+
+}
+
+using namespace test_CircularBuffer;
+
+// TStaticCircularBuffer behaves exactly like CircularBuffer
+TEST(CircularBuffer, Static)
+{
+  constexpr int N = 16;
+
+  CircularBuffer<int> expected{N};
+  TStaticCircularBuffer<int, N> actual{};
+  ASSERT_EQ(N, actual.getSize());
+
+  expected.init(3);
+  actual.init(3);
+
+  auto sum = [](int a, int b) { return a + b; };
+  auto concat = [](int a, int b) { return a * 31 + b; };
+
+  std::mt19937 generator{1};
+  std::uniform_int_distribution<int> offsets{-2 * N, 2 * N};
+  for(int i = 0; i < 10000; i++)
+  {
+    auto const offset = offsets(generator);
+    switch(i % 4)
+    {
+      case 0:
+        expected.setAt(offset, i);
+        actual.setAt(offset, i);
+        break;
+
+      case 1:
+        expected.incrementHead();
+        actual.incrementHead();
+        break;
+
+      default:
+        break;
+    }
+
+    ASSERT_EQ(expected.getAt(offset), actual.getAt(offset)) << i;
+
+    // fold in both directions (within the size)
+    auto const start = offset % N;
+    auto const end = offsets(generator) % N;
+    ASSERT_EQ(expected.fold(start, end, 0, sum), actual.fold(start, end, 0, sum)) << i;
+    ASSERT_EQ(expected.fold(start, end, 0, concat), actual.fold(start, end, 0, concat)) << i;
+    ASSERT_EQ(expected.fold(end, 0, concat), actual.fold(end, 0, concat)) << i;
+  }
+}
+
+TEST(CircularBuffer, Blocks)
+{
+  CircularBuffer<int> buffer{100};
+  testBlocks(buffer);
+
+  TStaticCircularBuffer<int, 128> staticBuffer{};
+  testBlocks(staticBuffer);
+
+  // audio buffers: delay by 100 samples
+  TStaticCircularBuffer<TJBox_AudioSample, 256> delay{};
+  AudioBuffer in{};
+  AudioBuffer out{};
+  for(int b = 0; b < 10; b++)
+  {
+    for(int i = 0; i < kBatchSize; i++)
+      in.fAudioBuffer[i] = static_cast<TJBox_AudioSample>(b * kBatchSize + i);
+    delay.writeBlock(in);
+    delay.readBlock(-kBatchSize - 100, out);
+    for(int i = 0; i < kBatchSize; i++)
+      ASSERT_EQ(std::max(b * kBatchSize + i - 100, 0), out.fAudioBuffer[i]);
+  }
+}
+
+}
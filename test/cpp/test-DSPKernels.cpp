@@ -0,0 +1,1029 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <DSPKernels.h>
+#include <AudioBuffer.h>
+#include <Denormals.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace dsp::Test {
+
+namespace test_DSPKernels {
+
+/**
+ * Generates `iCount` random samples in the range [-iRange, iRange] (deterministic) */
+std::vector<TJBox_AudioSample> randomSamples(int iCount, unsigned int iSeed, TJBox_AudioSample iRange = 1.0f)
+{
+  std::mt19937 generator{iSeed};
+  std::uniform_real_distribution<TJBox_AudioSample> distribution{-iRange, iRange};
+  std::vector<TJBox_AudioSample> res(iCount);
+  for(auto &s: res)
+    s = distribution(generator);
+  return res;
+}
+
+/**
+ * Compares 2 arrays of samples bit for bit */
+::testing::AssertionResult bitExact(std::vector<TJBox_AudioSample> const &iExpected,
+                                    std::vector<TJBox_AudioSample> const &iActual)
+{
+  if(iExpected.size() != iActual.size())
+    return ::testing::AssertionFailure() << "size mismatch " << iExpected.size() << " != " << iActual.size();
+
+  for(size_t i = 0; i < iExpected.size(); i++)
+  {
+    if(std::memcmp(&iExpected[i], &iActual[i], sizeof(TJBox_AudioSample)) != 0)
+      return ::testing::AssertionFailure() << "mismatch at [" << i << "] " << iExpected[i] << " != " << iActual[i];
+  }
+
+  return ::testing::AssertionSuccess();
+}
+
+// covers empty, smaller than a vector, exact multiples and all possible remainders
+constexpr int kMaxCount = 67;
+
+}
+
+using namespace test_DSPKernels;
+
+// accumulate
+TEST(DSPKernels, accumulate)
+{
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    auto src = randomSamples(count, 1);
+    auto expected = randomSamples(count, 2);
+    auto actual = expected;
+
+    scalar::accumulate(expected.data(), src.data(), count);
+    accumulate(actual.data(), src.data(), count);
+    ASSERT_TRUE(bitExact(expected, actual)) << "count=" << count;
+
+    // with gain
+    auto const dst = actual;
+    accumulate(actual.data(), src.data(), 0.3f, count);
+    for(int i = 0; i < count; i++)
+      ASSERT_NEAR(dst[i] + src[i] * 0.3f, actual[i], 1e-6f);
+  }
+}
+
+// copy
+TEST(DSPKernels, copy)
+{
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    auto src = randomSamples(count, 1);
+    auto actual = randomSamples(count, 2);
+
+    copy(actual.data(), src.data(), count);
+    ASSERT_TRUE(bitExact(src, actual)) << "count=" << count;
+  }
+}
+
+// adjustGain
+TEST(DSPKernels, adjustGain)
+{
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    for(auto gain: {0.0f, 0.5f, 1.0f, -1.3f, 3.7f})
+    {
+      auto expected = randomSamples(count, 1);
+      auto actual = expected;
+
+      scalar::adjustGain(expected.data(), gain, count);
+      adjustGain(actual.data(), gain, count);
+      ASSERT_TRUE(bitExact(expected, actual)) << "count=" << count << "/gain=" << gain;
+    }
+  }
+}
+
+// rampGain
+TEST(DSPKernels, rampGain)
+{
+  for(int count = 1; count <= kMaxCount; count++)
+  {
+    auto src = randomSamples(count, 1);
+
+    // mono
+    auto actual = src;
+    rampGain(actual.data(), 0.2f, 1.4f, count);
+    for(int i = 0; i < count; i++)
+    {
+      auto gain = 0.2 + i * (1.4 - 0.2) / count;
+      ASSERT_NEAR(src[i] * gain, actual[i], 1e-6) << "count=" << count << "/i=" << i;
+    }
+
+    // stereo is the same ramp applied to both channels
+    auto left = src;
+    auto right = randomSamples(count, 2);
+    auto expectedRight = right;
+    rampGain(expectedRight.data(), 0.2f, 1.4f, count);
+    rampGain(left.data(), right.data(), 0.2f, 1.4f, count);
+    ASSERT_TRUE(bitExact(actual, left)) << "count=" << count;
+    ASSERT_TRUE(bitExact(expectedRight, right)) << "count=" << count;
+
+    // no ramp => same as adjustGain
+    auto expected = src;
+    actual = src;
+    adjustGain(expected.data(), 0.7f, count);
+    rampGain(actual.data(), 0.7f, 0.7f, count);
+    ASSERT_TRUE(bitExact(expected, actual)) << "count=" << count;
+  }
+}
+
+// mix
+TEST(DSPKernels, mix)
+{
+  constexpr int kSourceCount = 5;
+  TJBox_Float32 const gains[kSourceCount] = {0.5f, 1.0f, -0.25f, 2.0f, 0.1f};
+
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    std::vector<std::vector<TJBox_AudioSample>> sources{};
+    TJBox_AudioSample const *srcs[kSourceCount];
+    for(int s = 0; s < kSourceCount; s++)
+    {
+      sources.emplace_back(randomSamples(count, s + 1));
+      srcs[s] = sources[s].data();
+    }
+
+    for(int sourceCount = 0; sourceCount <= kSourceCount; sourceCount++)
+    {
+      // reference: accumulate/adjustGain per source
+      std::vector<TJBox_AudioSample> expected(count, 0);
+      for(int s = 0; s < sourceCount; s++)
+      {
+        auto tmp = sources[s];
+        scalar::adjustGain(tmp.data(), gains[s], count);
+        scalar::accumulate(expected.data(), tmp.data(), count);
+      }
+
+      auto actual = randomSamples(count, 100);
+      mix(actual.data(), srcs, gains, sourceCount, count);
+      for(int i = 0; i < count; i++)
+        ASSERT_NEAR(expected[i], actual[i], 1e-6) << "count=" << count << "/sourceCount=" << sourceCount;
+    }
+  }
+}
+
+// TStereoAudioBuffer (planar storage)
+TEST(DSPKernels, TStereoAudioBuffer)
+{
+  static_assert(StereoAudioBuffer::kIsPlanar);
+  static_assert(!TStereoAudioBuffer<10>::kIsPlanar);
+
+  StereoAudioBuffer b1{};
+  StereoAudioBuffer b2{};
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(b1.data()) % kAudioBufferAlignment);
+  ASSERT_EQ(b1.fLeftAudioBuffer.fAudioBuffer, b1.data());
+  ASSERT_EQ(b1.fRightAudioBuffer.fAudioBuffer, b1.data() + kBatchSize);
+
+  auto src = randomSamples(2 * kBatchSize, 1);
+  auto dst = randomSamples(2 * kBatchSize, 2);
+  b1.deinterleave(src.data());
+  b2.deinterleave(dst.data());
+
+  // interleaved view
+  auto view = b1.interleaved();
+  ASSERT_EQ(2 * kBatchSize, view.getSize());
+  for(int i = 0; i < view.getSize(); i++)
+    ASSERT_EQ(src[i], view[i]);
+  std::vector<TJBox_AudioSample> interleaved(2 * kBatchSize);
+  b1.interleave(interleaved.data());
+  ASSERT_TRUE(bitExact(src, interleaved));
+
+  // the planar (fused) version must be identical to per channel processing
+  auto mono = [](StereoAudioBuffer const &b, int c) {
+    auto const &channel = c == 0 ? b.fLeftAudioBuffer : b.fRightAudioBuffer;
+    return std::vector<TJBox_AudioSample>(std::begin(channel.fAudioBuffer), std::end(channel.fAudioBuffer));
+  };
+
+  AudioBuffer expected[2]{};
+  for(int c = 0; c < 2; c++)
+  {
+    std::copy(std::begin(c == 0 ? b2.fLeftAudioBuffer.fAudioBuffer : b2.fRightAudioBuffer.fAudioBuffer),
+              std::end(c == 0 ? b2.fLeftAudioBuffer.fAudioBuffer : b2.fRightAudioBuffer.fAudioBuffer),
+              expected[c].fAudioBuffer);
+    expected[c].accumulate(c == 0 ? b1.fLeftAudioBuffer : b1.fRightAudioBuffer);
+    expected[c].adjustGain(0.3f);
+  }
+  b2.accumulate(b1);
+  b2.adjustGain(0.3f);
+  for(int c = 0; c < 2; c++)
+    ASSERT_TRUE(bitExact(mono(b2, c), {std::begin(expected[c].fAudioBuffer), std::end(expected[c].fAudioBuffer)}));
+  ASSERT_EQ(std::max(expected[0].max(), expected[1].max()), b2.max());
+
+  b2.copy(b1);
+  ASSERT_EQ(mono(b1, 0), mono(b2, 0));
+  ASSERT_EQ(mono(b1, 1), mono(b2, 1));
+
+  b2.clear();
+  ASSERT_TRUE(b2.isSilent());
+}
+
+// TMultiChannelAudioBuffer
+TEST(DSPKernels, TMultiChannelAudioBuffer)
+{
+  MultiChannelAudioBuffer<6> b1{};
+  MultiChannelAudioBuffer<6> b2{};
+  ASSERT_EQ(6, b1.getChannelCount());
+  ASSERT_EQ(b1.getChannel(5).fAudioBuffer, b1.data() + 5 * kBatchSize);
+
+  auto src = randomSamples(6 * kBatchSize, 1);
+  auto dst = randomSamples(6 * kBatchSize, 2);
+  std::copy(src.begin(), src.end(), b1.data());
+  std::copy(dst.begin(), dst.end(), b2.data());
+
+  b2.accumulate(b1);
+  b2.adjustGain(0.5f);
+  scalar::accumulate(dst.data(), src.data(), 6 * kBatchSize);
+  scalar::adjustGain(dst.data(), 0.5f, 6 * kBatchSize);
+  ASSERT_TRUE(bitExact(dst, {b2.data(), b2.data() + 6 * kBatchSize}));
+  ASSERT_EQ(scalar::max(dst.data(), 6 * kBatchSize), b2.max());
+  ASSERT_EQ(b2.max(), b2.analyze().fPeak);
+
+  // non planar version (per channel) must produce the same result
+  TMultiChannelAudioBuffer<3, 10> b3{};
+  b3.clear();
+  ASSERT_TRUE(b3.isSilent());
+  b3.getChannel(2).fAudioBuffer[9] = -0.5f;
+  ASSERT_EQ(0.5f, b3.max());
+  ASSERT_EQ(30, b3.analyze().fCount);
+
+  b2.clear();
+  ASSERT_TRUE(b2.isSilent());
+}
+
+// xFade
+TEST(DSPKernels, xFade)
+{
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    auto l1 = randomSamples(count, 1);
+    auto r1 = randomSamples(count, 2);
+    auto l2 = randomSamples(count, 3);
+    auto r2 = randomSamples(count, 4);
+    auto xf = randomSamples(count, 5);
+    auto rxf = randomSamples(count, 6);
+
+    std::vector<TJBox_AudioSample> left(count);
+    std::vector<TJBox_AudioSample> right(count);
+    xFade(left.data(), l1.data(), l2.data(), xf.data(), rxf.data(), count);
+    for(int i = 0; i < count; i++)
+      ASSERT_NEAR(l1[i] * xf[i] + l2[i] * rxf[i], left[i], 1e-6) << "count=" << count << "/i=" << i;
+
+    // stereo version is the same as mono for each channel
+    auto expectedRight = right;
+    xFade(expectedRight.data(), r1.data(), r2.data(), xf.data(), rxf.data(), count);
+    auto expectedLeft = left;
+    xFade(left.data(), right.data(), l1.data(), r1.data(), l2.data(), r2.data(), xf.data(), rxf.data(), count);
+    ASSERT_TRUE(bitExact(expectedLeft, left)) << "count=" << count;
+    ASSERT_TRUE(bitExact(expectedRight, right)) << "count=" << count;
+  }
+
+  // TStereoAudioBuffer::xFade (same formula as before, with the reverse curve)
+  LinearXFade<kBatchSize> linearXFade{};
+  StereoAudioBuffer b1{};
+  StereoAudioBuffer b2{};
+  StereoAudioBuffer out{};
+  auto src1 = randomSamples(2 * kBatchSize, 1);
+  auto src2 = randomSamples(2 * kBatchSize, 2);
+  std::copy(src1.begin(), src1.end(), b1.data());
+  std::copy(src2.begin(), src2.end(), b2.data());
+  out.xFade(linearXFade, b1, b2);
+  for(int i = 0; i < kBatchSize; i++)
+  {
+    auto xf = static_cast<TJBox_Float64>(i) / kBatchSize;
+    auto rxf = static_cast<TJBox_Float64>(kBatchSize - 1 - i) / kBatchSize;
+    ASSERT_NEAR(src1[i] * xf + src2[i] * rxf, out.fLeftAudioBuffer.fAudioBuffer[i], 1e-6);
+    ASSERT_NEAR(src1[i + kBatchSize] * xf + src2[i + kBatchSize] * rxf, out.fRightAudioBuffer.fAudioBuffer[i], 1e-6);
+  }
+}
+
+// XFade curves
+TEST(DSPKernels, XFadeCurves)
+{
+  // generated at compile time
+  static_assert(kLinearXFadeTable<4>.fXFadeFunction[1] == 0.25f);
+  static_assert(kSCurveXFadeTable<4>.fXFadeFunction[2] == 0.5f);
+
+  // shared table (no copy), default constructed => linear
+  XFadeCurve<kBatchSize> l1{};
+  XFadeCurve<kBatchSize> l2{};
+  ASSERT_EQ(l1.fXFadeFunction, l2.fXFadeFunction);
+  ASSERT_EQ(kLinearXFadeTable<kBatchSize>.fXFadeFunction, l1.fXFadeFunction);
+
+  LinearXFade<kBatchSize> linearXFade{};
+  auto const linearTable = linearXFade.toXFadeTable();
+
+  EqualPowerXFade<kBatchSize> equalPower{};
+  SCurveXFade<kBatchSize> sCurve{};
+  for(int i = 0; i < kBatchSize; i++)
+  {
+    auto t = static_cast<TJBox_Float64>(i) / kBatchSize;
+
+    // linear (unchanged)
+    ASSERT_EQ(t, linearXFade.fXFadeFunction[i]);
+    ASSERT_EQ(static_cast<TJBox_Float32>(i) / kBatchSize, l1.fXFadeFunction[i]);
+    ASSERT_EQ(l1.fXFadeFunction[kBatchSize - 1 - i], l1.fReverseXFadeFunction[i]);
+    ASSERT_EQ(l1.fXFadeFunction[i], linearTable.fXFadeFunction[i]);
+    ASSERT_EQ(l1.fReverseXFadeFunction[i], linearTable.fReverseXFadeFunction[i]);
+
+    // equal power
+    ASSERT_NEAR(std::sin(t * kPi / 2), equalPower.fXFadeFunction[i], 1e-7);
+    ASSERT_NEAR(std::cos(t * kPi / 2), equalPower.fReverseXFadeFunction[i], 1e-7);
+    ASSERT_NEAR(1.0, equalPower.fXFadeFunction[i] * equalPower.fXFadeFunction[i] +
+                     equalPower.fReverseXFadeFunction[i] * equalPower.fReverseXFadeFunction[i], 1e-6);
+
+    // S-curve
+    ASSERT_NEAR(t * t * (3 - 2 * t), sCurve.fXFadeFunction[i], 1e-7);
+    ASSERT_NEAR(1.0, sCurve.fXFadeFunction[i] + sCurve.fReverseXFadeFunction[i], 1e-6);
+  }
+
+  // the owned curve (XFade) and the shared one (XFadeCurve) produce the same result
+  StereoAudioBuffer b1{};
+  StereoAudioBuffer b2{};
+  auto src1 = randomSamples(2 * kBatchSize, 1);
+  auto src2 = randomSamples(2 * kBatchSize, 2);
+  std::copy(src1.begin(), src1.end(), b1.data());
+  std::copy(src2.begin(), src2.end(), b2.data());
+  StereoAudioBuffer out1{};
+  StereoAudioBuffer out2{};
+  out1.xFade(linearXFade, b1, b2);
+  out2.xFade(l1, b1, b2);
+  ASSERT_TRUE(bitExact({out1.data(), out1.data() + 2 * kBatchSize}, {out2.data(), out2.data() + 2 * kBatchSize}));
+
+  // custom curve filled in the constructor (as before)
+  struct SqrtXFade : public XFade<kBatchSize>
+  {
+    SqrtXFade()
+    {
+      for(int i = 0; i < kBatchSize; i++)
+        fXFadeFunction[i] = std::sqrt((double) i / kBatchSize);
+    }
+  };
+  SqrtXFade sqrtXFade{};
+  out1.xFade(sqrtXFade, b1, b2);
+  for(int i = 0; i < kBatchSize; i++)
+  {
+    auto xf = sqrtXFade.fXFadeFunction[i];
+    auto rxf = sqrtXFade.fXFadeFunction[kBatchSize - 1 - i];
+    ASSERT_NEAR(src1[i] * xf + src2[i] * rxf, out1.fLeftAudioBuffer.fAudioBuffer[i], 1e-6);
+  }
+
+  // custom curve filled at runtime
+  static XFadeTable<kBatchSize> custom{};
+  for(int i = 0; i < kBatchSize; i++)
+    custom.fXFadeFunction[i] = std::sqrt(static_cast<TJBox_Float32>(i) / kBatchSize);
+  custom.updateReverseXFadeFunction();
+  XFadeCurve<kBatchSize> customXFade{custom};
+  for(int i = 0; i < kBatchSize; i++)
+    ASSERT_EQ(customXFade.fXFadeFunction[kBatchSize - 1 - i], customXFade.fReverseXFadeFunction[i]);
+  out2.xFade(customXFade, b1, b2);
+  ASSERT_TRUE(bitExact({out1.data(), out1.data() + 2 * kBatchSize}, {out2.data(), out2.data() + 2 * kBatchSize}));
+}
+
+// clear
+TEST(DSPKernels, clear)
+{
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    auto actual = randomSamples(count, 1);
+    clear(actual.data(), count);
+    ASSERT_TRUE(bitExact(std::vector<TJBox_AudioSample>(count, 0), actual)) << "count=" << count;
+  }
+}
+
+// max
+TEST(DSPKernels, max)
+{
+  ASSERT_EQ(0, max(nullptr, 0));
+
+  for(int count = 1; count <= kMaxCount; count++)
+  {
+    auto src = randomSamples(count, 1);
+    ASSERT_EQ(scalar::max(src.data(), count), max(src.data(), count)) << "count=" << count;
+
+    // make sure the max is found in every position (including the scalar remainder) and for negative values
+    for(int i = 0; i < count; i++)
+    {
+      auto s = src;
+      s[i] = (i % 2 == 0) ? 2.0f : -2.0f;
+      ASSERT_EQ(2.0f, max(s.data(), count)) << "count=" << count << "/i=" << i;
+    }
+
+    // a NaN sample is ignored (like the scalar version) in every position
+    for(int i = 0; i < count; i++)
+    {
+      auto s = src;
+      s[i] = std::numeric_limits<TJBox_AudioSample>::quiet_NaN();
+      auto const expected = scalar::max(s.data(), count);
+      ASSERT_FALSE(std::isnan(expected));
+      ASSERT_TRUE(bitExact({expected}, {max(s.data(), count)})) << "count=" << count << "/i=" << i;
+
+      TJBox_AudioSample peak = 0;
+      TJBox_Float32 sum = 0;
+      TJBox_Float32 sumOfSquares = 0;
+      analyze(s.data(), count, peak, sum, sumOfSquares);
+      ASSERT_TRUE(bitExact({expected}, {peak})) << "count=" << count << "/i=" << i;
+    }
+  }
+}
+
+// analyze
+TEST(DSPKernels, analyze)
+{
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    auto src = randomSamples(count, 1);
+
+    TJBox_Float64 expectedSum = 0;
+    TJBox_Float64 expectedSumOfSquares = 0;
+    for(auto s: src)
+    {
+      expectedSum += s;
+      expectedSumOfSquares += s * s;
+    }
+
+    TJBox_AudioSample peak = 0;
+    TJBox_Float32 sum = 0;
+    TJBox_Float32 sumOfSquares = 0;
+    analyze(src.data(), count, peak, sum, sumOfSquares);
+
+    ASSERT_EQ(scalar::max(src.data(), count), peak) << "count=" << count;
+    ASSERT_NEAR(expectedSum, sum, 1e-4) << "count=" << count;
+    ASSERT_NEAR(expectedSumOfSquares, sumOfSquares, 1e-4) << "count=" << count;
+  }
+}
+
+// clamp
+TEST(DSPKernels, clamp)
+{
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    auto src = randomSamples(count, 1, 2.0f);
+
+    std::vector<TJBox_AudioSample> expected(count);
+    TJBox_Float32 expectedLowest = 1.0f;
+    TJBox_Float32 expectedHighest = -1.0f;
+    scalar::clamp(src.data(), expected.data(), -0.5f, 0.75f, count, expectedLowest, expectedHighest);
+
+    std::vector<TJBox_AudioSample> actual(count);
+    TJBox_Float32 lowest = 1.0f;
+    TJBox_Float32 highest = -1.0f;
+    clamp(src.data(), actual.data(), -0.5f, 0.75f, count, lowest, highest);
+    ASSERT_TRUE(bitExact(expected, actual)) << "count=" << count;
+    ASSERT_EQ(expectedLowest, lowest) << "count=" << count;
+    ASSERT_EQ(expectedHighest, highest) << "count=" << count;
+
+    auto const range = std::minmax_element(expected.begin(), expected.end());
+    ASSERT_EQ(count == 0 ? 1.0f : *range.first, lowest) << "count=" << count;
+    ASSERT_EQ(count == 0 ? -1.0f : *range.second, highest) << "count=" << count;
+
+    // in place
+    clamp(src.data(), src.data(), -0.5f, 0.75f, count, lowest, highest);
+    ASSERT_TRUE(bitExact(expected, src)) << "count=" << count;
+  }
+}
+
+// AudioBufferStats
+TEST(DSPKernels, AudioBufferStats)
+{
+  StereoAudioBuffer buffer{};
+  buffer.clear();
+  ASSERT_TRUE(buffer.analyze().isSilent());
+
+  // DC on the left channel only
+  std::fill(std::begin(buffer.fLeftAudioBuffer.fAudioBuffer), std::end(buffer.fLeftAudioBuffer.fAudioBuffer), 0.5f);
+
+  AudioBufferStats left{};
+  AudioBufferStats right{};
+  buffer.analyze(left, right);
+  ASSERT_FALSE(left.isSilent());
+  ASSERT_TRUE(right.isSilent());
+  ASSERT_EQ(0.5f, left.fPeak);
+  ASSERT_FLOAT_EQ(0.5f, left.rms());
+  ASSERT_FLOAT_EQ(0.5f, left.dcOffset());
+  ASSERT_EQ(left.isSilent(), buffer.fLeftAudioBuffer.isSilent());
+  ASSERT_EQ(right.isSilent(), buffer.fRightAudioBuffer.isSilent());
+
+  auto stereo = buffer.analyze();
+  ASSERT_EQ(2 * kBatchSize, stereo.fCount);
+  ASSERT_EQ(0.5f, stereo.fPeak);
+  ASSERT_FLOAT_EQ(0.25f, stereo.dcOffset());
+  ASSERT_FLOAT_EQ(std::sqrt(0.125f), stereo.rms());
+
+  // below the threshold is considered silent
+  buffer.fRightAudioBuffer.fAudioBuffer[3] = -kJBox_SilentThreshold;
+  ASSERT_TRUE(buffer.fRightAudioBuffer.analyze().isSilent());
+  ASSERT_TRUE(buffer.fRightAudioBuffer.isSilent());
+  buffer.fRightAudioBuffer.fAudioBuffer[3] = -2 * kJBox_SilentThreshold;
+  ASSERT_FALSE(buffer.fRightAudioBuffer.analyze().isSilent());
+  ASSERT_FALSE(buffer.fRightAudioBuffer.isSilent());
+
+  // single pass (planar) must match the per channel stats
+  auto src = randomSamples(2 * kBatchSize, 3);
+  std::copy(src.begin(), src.end(), buffer.data());
+  buffer.analyze(left, right);
+  left.merge(right);
+  stereo = buffer.analyze();
+  ASSERT_EQ(left.fCount, stereo.fCount);
+  ASSERT_EQ(left.fPeak, stereo.fPeak);
+  ASSERT_FLOAT_EQ(left.fSum, stereo.fSum);
+  ASSERT_FLOAT_EQ(left.fSumOfSquares, stereo.fSumOfSquares);
+
+  // non planar version (per channel)
+  TStereoAudioBuffer<10> b2{};
+  b2.clear();
+  b2.fRightAudioBuffer.fAudioBuffer[9] = -0.5f;
+  ASSERT_EQ(20, b2.analyze().fCount);
+  ASSERT_EQ(0.5f, b2.analyze().fPeak);
+}
+
+// TAudioBuffer (delegates to the kernels)
+TEST(DSPKernels, TAudioBuffer)
+{
+  auto src = randomSamples(kBatchSize, 1);
+  auto dst = randomSamples(kBatchSize, 2);
+
+  AudioBuffer b1{};
+  AudioBuffer b2{};
+  std::copy(src.begin(), src.end(), b1.fAudioBuffer);
+  std::copy(dst.begin(), dst.end(), b2.fAudioBuffer);
+
+  b2.accumulate(b1);
+  scalar::accumulate(dst.data(), src.data(), kBatchSize);
+  ASSERT_TRUE(bitExact(dst, {std::begin(b2.fAudioBuffer), std::end(b2.fAudioBuffer)}));
+
+  b2.adjustGain(0.3f);
+  scalar::adjustGain(dst.data(), 0.3f, kBatchSize);
+  ASSERT_TRUE(bitExact(dst, {std::begin(b2.fAudioBuffer), std::end(b2.fAudioBuffer)}));
+
+  ASSERT_EQ(scalar::max(dst.data(), kBatchSize), b2.max());
+
+  b2.copy(b1);
+  ASSERT_TRUE(bitExact(src, {std::begin(b2.fAudioBuffer), std::end(b2.fAudioBuffer)}));
+
+  b2.clear();
+  ASSERT_EQ(0, b2.max());
+  ASSERT_TRUE(b2.isSilent());
+}
+
+
+// sub block (offset, count) variants and spans
+TEST(DSPKernels, AudioSpan)
+{
+  auto src = randomSamples(kBatchSize, 1);
+  auto dst = randomSamples(kBatchSize, 2);
+
+  auto toVector = [](AudioBuffer const &b) {
+    return std::vector<TJBox_AudioSample>(std::begin(b.fAudioBuffer), std::end(b.fAudioBuffer));
+  };
+
+  // splitting at every possible frame index must produce the same result as processing the full buffer
+  for(int frameIndex = 0; frameIndex <= kBatchSize; frameIndex++)
+  {
+    AudioBuffer b1{};
+    AudioBuffer full{};
+    AudioBuffer split{};
+    std::copy(src.begin(), src.end(), b1.fAudioBuffer);
+    std::copy(dst.begin(), dst.end(), full.fAudioBuffer);
+    std::copy(dst.begin(), dst.end(), split.fAudioBuffer);
+
+    full.accumulate(b1);
+    split.accumulate(b1, 0, frameIndex);
+    split.accumulate(b1, frameIndex, kBatchSize - frameIndex);
+    ASSERT_TRUE(bitExact(toVector(full), toVector(split)));
+
+    full.adjustGain(0.7f);
+    split.adjustGain(0.7f, 0, frameIndex);
+    split.span(frameIndex, kBatchSize - frameIndex).adjustGain(0.7f);
+    ASSERT_TRUE(bitExact(toVector(full), toVector(split)));
+
+    // gain change at frameIndex: ramp up to frameIndex then constant
+    std::copy(dst.begin(), dst.end(), full.fAudioBuffer);
+    std::copy(dst.begin(), dst.end(), split.fAudioBuffer);
+    split.adjustGain(0.5f, 0.9f, 0, frameIndex);
+    split.adjustGain(0.9f, frameIndex, kBatchSize - frameIndex);
+    for(int i = 0; i < kBatchSize; i++)
+    {
+      auto gain = i < frameIndex ? 0.5f + (0.9f - 0.5f) * i / frameIndex : 0.9f;
+      ASSERT_NEAR(dst[i] * gain, split.fAudioBuffer[i], 1e-6f) << "frameIndex=" << frameIndex << " i=" << i;
+    }
+
+    split.copy(b1, frameIndex, kBatchSize - frameIndex);
+    split.clear(0, frameIndex);
+    for(int i = 0; i < kBatchSize; i++)
+      ASSERT_EQ(i < frameIndex ? 0 : src[i], split.fAudioBuffer[i]);
+  }
+
+  // span accessors
+  AudioBuffer b{};
+  std::copy(src.begin(), src.end(), b.fAudioBuffer);
+  AudioSpan span = b.span(10, 20);
+  ConstAudioSpan constSpan = span;
+  ASSERT_EQ(20, constSpan.getSize());
+  ASSERT_EQ(b.fAudioBuffer + 10, constSpan.data());
+  ASSERT_EQ(src[12], constSpan[2]);
+  ASSERT_EQ(b.fAudioBuffer + 15, span.subSpan(5, 3).data());
+  ASSERT_EQ(scalar::max(src.data() + 10, 20), span.max());
+  ASSERT_EQ(20, span.analyze().fCount);
+  span.clear();
+  ASSERT_TRUE(span.isSilent());
+  ASSERT_EQ(src[9], b.fAudioBuffer[9]);
+  ASSERT_EQ(src[30], b.fAudioBuffer[30]);
+}
+
+// sub block stereo xFade / rampGain
+TEST(DSPKernels, StereoAudioSpan)
+{
+  StereoAudioBuffer b1{};
+  StereoAudioBuffer b2{};
+  b1.deinterleave(randomSamples(2 * kBatchSize, 1).data());
+  b2.deinterleave(randomSamples(2 * kBatchSize, 2).data());
+
+  LinearXFade<kBatchSize> xf{};
+
+  for(int frameIndex = 0; frameIndex <= kBatchSize; frameIndex += 7)
+  {
+    StereoAudioBuffer full{};
+    StereoAudioBuffer split{};
+
+    full.xFade(xf, b1, b2);
+    split.xFade(xf, b1, b2, 0, frameIndex);
+    split.xFade(xf, b1, b2, frameIndex, kBatchSize - frameIndex);
+    for(int i = 0; i < kBatchSize; i++)
+    {
+      ASSERT_NEAR(full.fLeftAudioBuffer.fAudioBuffer[i], split.fLeftAudioBuffer.fAudioBuffer[i], 1e-6f);
+      ASSERT_NEAR(full.fRightAudioBuffer.fAudioBuffer[i], split.fRightAudioBuffer.fAudioBuffer[i], 1e-6f);
+    }
+
+    split.copy(b1, 0, kBatchSize);
+    split.rampGain(1.0f, 0.5f, frameIndex, kBatchSize - frameIndex);
+    for(int i = 0; i < kBatchSize; i++)
+    {
+      auto gain = i < frameIndex ? 1.0f : 1.0f - 0.5f * (i - frameIndex) / (kBatchSize - frameIndex);
+      ASSERT_NEAR(b1.fLeftAudioBuffer.fAudioBuffer[i] * gain, split.fLeftAudioBuffer.fAudioBuffer[i], 1e-6f);
+      ASSERT_NEAR(b1.fRightAudioBuffer.fAudioBuffer[i] * gain, split.fRightAudioBuffer.fAudioBuffer[i], 1e-6f);
+    }
+  }
+
+  StereoAudioBuffer const &cb1 = b1;
+  ConstStereoAudioSpan span = cb1.span(8, 8);
+  ASSERT_EQ(8, span.getSize());
+  ASSERT_EQ(b1.fRightAudioBuffer.fAudioBuffer + 8, span.fRight.data());
+  ASSERT_EQ(std::max(b1.fLeftAudioBuffer.span(8, 8).max(), b1.fRightAudioBuffer.span(8, 8).max()), span.max());
+}
+
+// multiply / multiplyAdd
+TEST(DSPKernels, multiply)
+{
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    auto gains = randomSamples(count, 1);
+    auto expected = randomSamples(count, 2);
+    auto actual = expected;
+
+    scalar::multiply(expected.data(), gains.data(), count);
+    multiply(actual.data(), gains.data(), count);
+    ASSERT_TRUE(bitExact(expected, actual)) << "count=" << count;
+
+    scalar::multiplyAdd(expected.data(), gains.data(), 0.3f, -0.2f, count);
+    multiplyAdd(actual.data(), gains.data(), 0.3f, -0.2f, count);
+    for(int i = 0; i < count; i++)
+      ASSERT_NEAR(expected[i], actual[i], 1e-6f);
+  }
+}
+
+// adjustGain / rampGain with a gain per channel
+TEST(DSPKernels, stereoGains)
+{
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    auto expectedLeft = randomSamples(count, 1);
+    auto expectedRight = randomSamples(count, 2);
+    auto actualLeft = expectedLeft;
+    auto actualRight = expectedRight;
+
+    scalar::adjustGain(expectedLeft.data(), expectedRight.data(), 0.3f, 0.8f, count);
+    adjustGain(actualLeft.data(), actualRight.data(), 0.3f, 0.8f, count);
+    ASSERT_TRUE(bitExact(expectedLeft, actualLeft)) << "count=" << count;
+    ASSERT_TRUE(bitExact(expectedRight, actualRight)) << "count=" << count;
+
+    auto left = actualLeft;
+    auto right = actualRight;
+    rampGain(left.data(), right.data(), 0.2f, 0.6f, 1.0f, 0.5f, count);
+    for(int i = 0; i < count; i++)
+    {
+      auto const t = static_cast<TJBox_Float32>(i) / count;
+      ASSERT_NEAR(actualLeft[i] * (0.2f + t * 0.4f), left[i], 1e-6f);
+      ASSERT_NEAR(actualRight[i] * (1.0f - t * 0.5f), right[i], 1e-6f);
+    }
+  }
+}
+
+// pan / balance
+TEST(DSPKernels, Pan)
+{
+  // constant power
+  for(TJBox_Float32 pan = -1.0f; pan <= 1.0f; pan += 0.01f)
+  {
+    auto const gains = computePanGains(pan);
+    auto const t = (pan + 1.0) / 2.0;
+    ASSERT_NEAR(std::cos(t * kPi / 2), gains.fLeft, 5e-6);
+    ASSERT_NEAR(std::sin(t * kPi / 2), gains.fRight, 5e-6);
+    ASSERT_NEAR(1.0f, gains.fLeft * gains.fLeft + gains.fRight * gains.fRight, 1e-5f);
+  }
+  ASSERT_EQ(1.0f, computePanGains(-1.0f).fLeft);
+  ASSERT_EQ(0.0f, computePanGains(-1.0f).fRight);
+  ASSERT_EQ(0.0f, computePanGains(1.0f).fLeft);
+  ASSERT_EQ(1.0f, computePanGains(1.0f).fRight);
+  ASSERT_EQ(computePanGains(0).fLeft, computePanGains(0).fRight);
+
+  // balance
+  ASSERT_EQ(1.0f, computeBalanceGains(0).fLeft);
+  ASSERT_EQ(1.0f, computeBalanceGains(0).fRight);
+  ASSERT_EQ(1.0f, computeBalanceGains(0.5f).fRight);
+  ASSERT_NEAR(std::cos(0.5 * kPi / 2), computeBalanceGains(0.5f).fLeft, 5e-6);
+  ASSERT_EQ(0.0f, computeBalanceGains(-1.0f).fRight);
+
+  StereoAudioBuffer buffer{};
+  std::fill(std::begin(buffer.fLeftAudioBuffer.fAudioBuffer), std::end(buffer.fLeftAudioBuffer.fAudioBuffer), 1.0f);
+  std::fill(std::begin(buffer.fRightAudioBuffer.fAudioBuffer), std::end(buffer.fRightAudioBuffer.fAudioBuffer), 1.0f);
+  StereoAudioBuffer ramped = buffer;
+
+  buffer.pan(0.5f);
+  auto const gains = computePanGains(0.5f);
+  for(int i = 0; i < kBatchSize; i++)
+  {
+    ASSERT_EQ(gains.fLeft, buffer.fLeftAudioBuffer.fAudioBuffer[i]);
+    ASSERT_EQ(gains.fRight, buffer.fRightAudioBuffer.fAudioBuffer[i]);
+  }
+
+  // ramp: starts at the first position and reaches the second one on the next batch
+  ramped.pan(-1.0f, 0.5f);
+  ASSERT_EQ(1.0f, ramped.fLeftAudioBuffer.fAudioBuffer[0]);
+  ASSERT_EQ(0.0f, ramped.fRightAudioBuffer.fAudioBuffer[0]);
+  ASSERT_NEAR(gains.fLeft, ramped.fLeftAudioBuffer.fAudioBuffer[kBatchSize - 1], 0.02f);
+  ASSERT_NEAR(gains.fRight, ramped.fRightAudioBuffer.fAudioBuffer[kBatchSize - 1], 0.02f);
+}
+
+// midSideEncode / midSideDecode / stereoWidth
+TEST(DSPKernels, midSide)
+{
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    auto const left = randomSamples(count, 1);
+    auto const right = randomSamples(count, 2);
+
+    auto expectedLeft = left;
+    auto expectedRight = right;
+    auto actualLeft = left;
+    auto actualRight = right;
+
+    scalar::midSideEncode(expectedLeft.data(), expectedRight.data(), count);
+    midSideEncode(actualLeft.data(), actualRight.data(), count);
+    ASSERT_TRUE(bitExact(expectedLeft, actualLeft)) << "count=" << count;
+    ASSERT_TRUE(bitExact(expectedRight, actualRight)) << "count=" << count;
+    for(int i = 0; i < count; i++)
+    {
+      ASSERT_EQ((left[i] + right[i]) * 0.5f, actualLeft[i]);
+      ASSERT_EQ((left[i] - right[i]) * 0.5f, actualRight[i]);
+    }
+
+    scalar::midSideDecode(expectedLeft.data(), expectedRight.data(), count);
+    midSideDecode(actualLeft.data(), actualRight.data(), count);
+    ASSERT_TRUE(bitExact(expectedLeft, actualLeft)) << "count=" << count;
+    ASSERT_TRUE(bitExact(expectedRight, actualRight)) << "count=" << count;
+    for(int i = 0; i < count; i++)
+    {
+      ASSERT_NEAR(left[i], actualLeft[i], 1e-6f);
+      ASSERT_NEAR(right[i], actualRight[i], 1e-6f);
+    }
+
+    for(auto w: {0.0f, 0.5f, 1.0f, 2.0f})
+    {
+      actualLeft = left;
+      actualRight = right;
+      stereoWidth(actualLeft.data(), actualRight.data(), w, count);
+      for(int i = 0; i < count; i++)
+      {
+        auto const mid = (left[i] + right[i]) * 0.5f;
+        auto const side = (left[i] - right[i]) * 0.5f * w;
+        ASSERT_NEAR(mid + side, actualLeft[i], 1e-6f);
+        ASSERT_NEAR(mid - side, actualRight[i], 1e-6f);
+        if(w == 0)
+        {
+          ASSERT_EQ(actualLeft[i], actualRight[i]);
+        }
+      }
+    }
+  }
+}
+
+// fastTanh / softClip / hardClip / asymmetricClip
+TEST(DSPKernels, saturation)
+{
+  for(TJBox_Float32 x = -20.0f; x <= 20.0f; x += 0.001f)
+  {
+    auto const y = fastTanh(x);
+    ASSERT_NEAR(std::tanh(static_cast<double>(x)), y, 5e-7) << "x=" << x;
+    ASSERT_LE(std::abs(y), 1.0f);
+    ASSERT_EQ(-y, fastTanh(-x));
+  }
+  ASSERT_EQ(0.0f, fastTanh(0));
+  ASSERT_EQ(1.0f, fastTanh(100.0f));
+  ASSERT_EQ(-1.0f, fastTanh(-std::numeric_limits<TJBox_Float32>::infinity()));
+
+  // saturation is exact in the vectorized version as well
+  auto loud = randomSamples(kMaxCount, 3);
+  for(auto &s: loud)
+    s += s < 0 ? -0.1f : 0.1f;
+  auto const expectedLoud = loud;
+  softClip(loud.data(), 100.0f, 1.0f, kMaxCount);
+  for(int i = 0; i < kMaxCount; i++)
+    ASSERT_EQ(expectedLoud[i] < 0 ? -1.0f : 1.0f, loud[i]) << i;
+
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    auto const src = randomSamples(count, 1, 2.0f);
+    for(auto drive: {1.0f, 4.0f})
+    {
+      for(auto mix: {1.0f, 0.5f})
+      {
+        auto soft = src;
+        softClip(soft.data(), drive, mix, count);
+        auto hard = src;
+        hardClip(hard.data(), drive, mix, count);
+        auto asymmetric = src;
+        asymmetricClip(asymmetric.data(), drive, 0.3f, mix, count);
+        for(int i = 0; i < count; i++)
+        {
+          auto const dry = src[i] * (1.0f - mix);
+          ASSERT_NEAR(std::tanh(src[i] * drive) * mix + dry, soft[i], 1e-6f);
+          ASSERT_NEAR(std::clamp(src[i] * drive, -1.0f, 1.0f) * mix + dry, hard[i], 1e-6f);
+          ASSERT_NEAR((std::tanh(src[i] * drive + 0.3f) - std::tanh(0.3f)) * mix + dry, asymmetric[i], 2e-6f);
+        }
+      }
+    }
+
+    // hard clip is exact when fully wet
+    auto expected = src;
+    auto actual = src;
+    scalar::hardClip(expected.data(), 2.0f, 1.0f, count);
+    hardClip(actual.data(), 2.0f, 1.0f, count);
+    ASSERT_TRUE(bitExact(expected, actual)) << "count=" << count;
+  }
+
+  // silence stays silent
+  StereoAudioBuffer buffer{};
+  buffer.clear();
+  buffer.asymmetricClip(0.5f, 10.0f);
+  ASSERT_EQ(0, buffer.max());
+  buffer.fLeftAudioBuffer.fAudioBuffer[0] = 2.0f;
+  buffer.fRightAudioBuffer.fAudioBuffer[kBatchSize - 1] = -2.0f;
+  buffer.softClip();
+  ASSERT_EQ(fastTanh(2.0f), buffer.fLeftAudioBuffer.fAudioBuffer[0]);
+  ASSERT_EQ(fastTanh(-2.0f), buffer.fRightAudioBuffer.fAudioBuffer[kBatchSize - 1]);
+}
+
+// fastLog2 / fastExp2
+TEST(DSPKernels, fastLog2Exp2)
+{
+  ASSERT_EQ(0, fastLog2(1.0f));
+  ASSERT_EQ(-127, fastLog2(0.0f));
+  ASSERT_EQ(3, fastLog2(-8.0f));
+  ASSERT_EQ(1.0f, fastExp2(0));
+  ASSERT_EQ(8.0f, fastExp2(3));
+  ASSERT_EQ(std::numeric_limits<TJBox_Float32>::min(), fastExp2(-std::numeric_limits<TJBox_Float32>::infinity()));
+
+  TJBox_Float64 maxLog2Error = 0;
+  TJBox_Float64 maxExp2Error = 0;
+  for(TJBox_Float64 x = 1e-30; x < 1e30; x *= 1.0001)
+  {
+    auto const value = static_cast<TJBox_Float32>(x);
+    auto const exact = std::log2(static_cast<TJBox_Float64>(value));
+    // the approximation error is 1.2e-6 but the float rounding of the result dominates for large values
+    auto const error = std::fabs(fastLog2(value) - exact);
+    if(std::fabs(exact) < 1)
+    {
+      ASSERT_LT(error, 1.2e-6);
+    }
+    maxLog2Error = std::max(maxLog2Error, error);
+  }
+  for(TJBox_Float64 x = -100; x < 100; x += 0.001)
+  {
+    auto const value = static_cast<TJBox_Float32>(x);
+    maxExp2Error = std::max(maxExp2Error, std::fabs(fastExp2(value) / std::exp2(static_cast<TJBox_Float64>(value)) - 1));
+  }
+  ASSERT_LT(maxLog2Error, 6e-6);
+  ASSERT_LT(maxExp2Error, 2e-7);
+}
+
+// linearToDb / dbToLinear
+TEST(DSPKernels, linearToDb)
+{
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    auto src = randomSamples(count, 1);
+    if(count > 0)
+      src[0] = 0; // silence
+
+    std::vector<TJBox_Float32> expected(count);
+    std::vector<TJBox_Float32> actual(count);
+    scalar::linearToDb(src.data(), expected.data(), count, -120.0f);
+    linearToDb(src.data(), actual.data(), count, -120.0f);
+
+    for(int i = 0; i < count; i++)
+    {
+      ASSERT_NEAR(expected[i], actual[i], 1e-5f);
+      auto const exact = std::max(20.0 * std::log10(std::fabs(static_cast<TJBox_Float64>(src[i]))), -120.0);
+      ASSERT_NEAR(exact, actual[i], 1e-4);
+    }
+
+    // back to linear (in place)
+    scalar::dbToLinear(expected.data(), expected.data(), count);
+    dbToLinear(actual.data(), actual.data(), count);
+    for(int i = 0; i < count; i++)
+    {
+      ASSERT_NEAR(expected[i], actual[i], 1e-6f);
+      auto const exact = src[i] == 0 ? 1e-6f : std::fabs(src[i]); // -120dB
+      ASSERT_NEAR(exact, actual[i], 1e-5f * exact);
+    }
+  }
+}
+
+// flushDenormals / flushDenormal
+TEST(DSPKernels, flushDenormals)
+{
+  auto constexpr denormal = std::numeric_limits<TJBox_AudioSample>::min() / 4;
+
+  ASSERT_EQ(0, flushDenormal(denormal));
+  ASSERT_EQ(0, flushDenormal(-denormal));
+  ASSERT_EQ(std::numeric_limits<TJBox_AudioSample>::min(), flushDenormal(std::numeric_limits<TJBox_AudioSample>::min()));
+  ASSERT_EQ(0.5f, flushDenormal(0.5f));
+
+  for(int count = 0; count <= kMaxCount; count++)
+  {
+    auto expected = randomSamples(count, 1);
+    for(int i = 0; i < count; i += 3)
+      expected[i] *= denormal;
+    auto actual = expected;
+
+    scalar::flushDenormals(expected.data(), count);
+    flushDenormals(actual.data(), count);
+    ASSERT_TRUE(bitExact(expected, actual)) << "count=" << count;
+
+    for(int i = 0; i < count; i++)
+      ASSERT_TRUE(actual[i] == 0 || std::fabs(actual[i]) >= std::numeric_limits<TJBox_AudioSample>::min());
+  }
+
+  StereoAudioBuffer buffer{};
+  buffer.fLeftAudioBuffer.fAudioBuffer[3] = denormal;
+  buffer.fRightAudioBuffer.fAudioBuffer[5] = 0.25f;
+  buffer.flushDenormals();
+  ASSERT_EQ(0, buffer.fLeftAudioBuffer.fAudioBuffer[3]);
+  ASSERT_EQ(0.25f, buffer.fRightAudioBuffer.fAudioBuffer[5]);
+}
+
+// ScopedFlushDenormals
+TEST(DSPKernels, ScopedFlushDenormals)
+{
+  volatile TJBox_AudioSample denormal = std::numeric_limits<TJBox_AudioSample>::min();
+  volatile TJBox_AudioSample half = 0.5f;
+
+  ASSERT_NE(0, denormal * half);
+
+  {
+    ScopedFlushDenormals flushDenormals{};
+#if RE_COMMON_DENORMALS_MXCSR || RE_COMMON_DENORMALS_FPCR
+    ASSERT_EQ(0, denormal * half);
+#endif
+  }
+
+  // previous mode is restored
+  ASSERT_NE(0, denormal * half);
+}
+
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <DelayLine.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <functional>
+
+namespace pongasoft::common::Test {
+
+namespace test_DelayLine {
+
+using Signal = std::function<double(int)>;
+using Delay = std::function<TJBox_Float32(int)>;
+
+// runs `batches` batches through the delay line and checks the output against `iSignal(t - delay(t))`
+template<int capacity>
+void testDelayLine(EDelayInterpolation iInterpolation, Signal const &iSignal, Delay const &iDelay, int iBatches,
+                   int iSkip, double iTolerance)
+{
+  TDelayLine<capacity> delayLine{iInterpolation};
+  AudioBuffer buffer{};
+  TJBox_Float32 delays[kBatchSize];
+
+  for(int b = 0; b < iBatches; b++)
+  {
+    for(int i = 0; i < kBatchSize; i++)
+    {
+      auto const t = b * kBatchSize + i;
+      buffer.fAudioBuffer[i] = static_cast<TJBox_AudioSample>(iSignal(t));
+      delays[i] = iDelay(t);
+    }
+
+    delayLine.process(buffer, delays);
+
+    for(int i = 0; i < kBatchSize; i++)
+    {
+      auto const t = b * kBatchSize + i;
+      if(t < iSkip)
+        continue;
+      auto const delayed = static_cast<double>(t) - static_cast<double>(delays[i]);
+      auto const i0 = static_cast<int>(std::floor(delayed));
+      // the signal is only defined at integer positions: a linear signal is interpolated exactly
+      auto const f = delayed - i0;
+      auto const expected = iSignal(i0) + f * (iSignal(i0 + 1) - iSignal(i0));
+      ASSERT_NEAR(expected, buffer.fAudioBuffer[i], iTolerance) << t;
+    }
+  }
+}
+
+}
+
+using namespace test_DelayLine;
+
+// integer delays are exact (whatever the interpolation)
+TEST(DelayLine, Integer)
+{
+  auto ramp = [](int t) { return t < 0 ? 0.0 : static_cast<double>(t); };
+  for(auto interpolation: {EDelayInterpolation::kLinear, EDelayInterpolation::kHermite, EDelayInterpolation::kAllPass})
+  {
+    testDelayLine<1024>(interpolation, ramp, [](int) { return 100.0f; }, 20, 0, 0);
+    testDelayLine<1024>(interpolation, ramp, [](int) { return 2.0f; }, 20, 0, 0);
+    testDelayLine<1024>(interpolation, ramp, [](int) { return 1024.0f - kBatchSize - 2; }, 40, 0, 0);
+  }
+
+  // delays are clamped
+  TDelayLine<256> delayLine{};
+  AudioBuffer buffer{};
+  for(int b = 0; b < 10; b++)
+  {
+    for(int i = 0; i < kBatchSize; i++)
+      buffer.fAudioBuffer[i] = static_cast<TJBox_AudioSample>(b * kBatchSize + i);
+    delayLine.process(buffer, 0.0f);
+    for(int i = 0; i < kBatchSize; i++)
+      ASSERT_EQ(std::max(b * kBatchSize + i - 1, 0), buffer.fAudioBuffer[i]);
+  }
+}
+
+// modulated (fractional) delays on a ramp: linear and hermite interpolations are exact (once the delay line is full
+// since the ramp starts with a kink)
+TEST(DelayLine, Modulated)
+{
+  auto ramp = [](int t) { return t < 0 ? 0.0 : t * 0.01; };
+
+  // chorus like modulation (block path)
+  auto chorus = [](int t) { return static_cast<TJBox_Float32>(300.0 + 50.0 * std::sin(2.0 * kPi * t / 4410.0)); };
+  testDelayLine<1024>(EDelayInterpolation::kLinear, ramp, chorus, 100, 1024, 1e-4);
+  testDelayLine<1024>(EDelayInterpolation::kHermite, ramp, chorus, 100, 1024, 1e-4);
+
+  // pitch shift like modulation (delay decreasing 1 sample per sample => 2x speed)
+  auto pitch = [](int t) { return static_cast<TJBox_Float32>(500.0 - (t % 400) + 0.25); };
+  testDelayLine<1024>(EDelayInterpolation::kLinear, ramp, pitch, 100, 1024, 1e-4);
+  testDelayLine<1024>(EDelayInterpolation::kHermite, ramp, pitch, 100, 1024, 1e-4);
+
+  // delays jumping around in the batch (one window per sample)
+  auto jumps = [](int t) { return static_cast<TJBox_Float32>((t % 2) == 0 ? 10.5 : 700.25); };
+  testDelayLine<1024>(EDelayInterpolation::kLinear, ramp, jumps, 100, 1024, 1e-4);
+  testDelayLine<1024>(EDelayInterpolation::kHermite, ramp, jumps, 100, 1024, 1e-4);
+}
+
+// all pass interpolation close to an integer position (f -> 1) must not ring
+TEST(DelayLine, AllPassNearInteger)
+{
+  for(auto delay: {10.01f, 10.5f, 10.99f})
+  {
+    TDelayLine<1024> delayLine{EDelayInterpolation::kAllPass};
+    AudioBuffer buffer{};
+    buffer.clear();
+    buffer.fAudioBuffer[0] = 1.0f; // impulse
+    delayLine.process(buffer, delay);
+
+    // the filter may start 1 sample early (D in [0.5, 1.5) from the newest sample of the pair)
+    auto const d = static_cast<int>(delay);
+    for(int i = 0; i < d - 1; i++)
+    {
+      ASSERT_EQ(0, buffer.fAudioBuffer[i]) << "delay=" << delay << " i=" << i;
+    }
+
+    // the impulse lands around the delay and the ringing is gone after a few samples
+    auto const energy = buffer.fAudioBuffer[d - 1] * buffer.fAudioBuffer[d - 1] +
+                        buffer.fAudioBuffer[d] * buffer.fAudioBuffer[d] +
+                        buffer.fAudioBuffer[d + 1] * buffer.fAudioBuffer[d + 1];
+    ASSERT_GT(energy, 0.85f) << "delay=" << delay;
+    for(int i = d + 8; i < kBatchSize; i++)
+    {
+      ASSERT_LT(std::abs(buffer.fAudioBuffer[i]), 1e-3f) << "delay=" << delay << " i=" << i;
+    }
+  }
+}
+
+// fractional delays on a sine wave
+TEST(DelayLine, Fractional)
+{
+  // 1kHz @ 44.1kHz
+  auto sine = [](int t) { return std::sin(2.0 * kPi * 1000.0 * t / 44100.0); };
+  auto exact = [&sine](TJBox_Float32 iDelay, int t) {
+    return std::sin(2.0 * kPi * 1000.0 * (t - static_cast<double>(iDelay)) / 44100.0);
+  };
+
+  for(auto interpolation: {EDelayInterpolation::kLinear, EDelayInterpolation::kHermite, EDelayInterpolation::kAllPass})
+  {
+    TDelayLine<1024> delayLine{interpolation};
+    AudioBuffer buffer{};
+    double maxError = 0;
+    double peak = 0;
+    for(int b = 0; b < 100; b++)
+    {
+      for(int i = 0; i < kBatchSize; i++)
+        buffer.fAudioBuffer[i] = static_cast<TJBox_AudioSample>(sine(b * kBatchSize + i));
+      delayLine.process(buffer, 100.5f);
+
+      // skip the start (the all pass filter needs to settle)
+      if(b < 10)
+        continue;
+
+      for(int i = 0; i < kBatchSize; i++)
+      {
+        maxError = std::max(maxError, std::abs(exact(100.5f, b * kBatchSize + i) - buffer.fAudioBuffer[i]));
+        peak = std::max(peak, std::abs(static_cast<double>(buffer.fAudioBuffer[i])));
+      }
+    }
+
+    switch(interpolation)
+    {
+      case EDelayInterpolation::kLinear:
+        // linear interpolation attenuates: cos(pi * f / sr) at half a sample
+        ASSERT_NEAR(std::cos(kPi * 1000.0 / 44100.0), peak, 1e-3);
+        ASSERT_LT(maxError, 3e-3);
+        break;
+
+      case EDelayInterpolation::kHermite:
+        ASSERT_LT(maxError, 1e-4);
+        break;
+
+      case EDelayInterpolation::kAllPass:
+        // flat magnitude response
+        ASSERT_NEAR(1.0, peak, 1e-3);
+        ASSERT_LT(maxError, 1e-3);
+        break;
+    }
+  }
+}
+
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <Dynamics.h>
+#include <gtest/gtest.h>
+#include <cmath>
+
+namespace pongasoft::common::Test {
+
+namespace test_Dynamics {
+
+TJBox_Float32 toDb(TJBox_Float32 iGain) { return 20.0f * std::log10(iGain); }
+
+}
+
+using namespace test_Dynamics;
+
+// Static curve (gain computer)
+TEST(Dynamics, GainComputer)
+{
+  DynamicsParameters compressor{};
+  compressor.fThresholdDb = -20;
+  compressor.fRatio = 4;
+  compressor.fKneeDb = 0;
+
+  ASSERT_EQ(0, Dynamics::computeGainReductionDb(compressor, -30));
+  ASSERT_EQ(0, Dynamics::computeGainReductionDb(compressor, -20));
+  ASSERT_FLOAT_EQ(-7.5f, Dynamics::computeGainReductionDb(compressor, -10));
+
+  // soft knee: quadratic between -23 and -17, continuous on both ends
+  compressor.fKneeDb = 6;
+  ASSERT_EQ(0, Dynamics::computeGainReductionDb(compressor, -23));
+  ASSERT_FLOAT_EQ(-0.5625f, Dynamics::computeGainReductionDb(compressor, -20));
+  ASSERT_FLOAT_EQ(-2.25f, Dynamics::computeGainReductionDb(compressor, -17));
+  ASSERT_FLOAT_EQ(-7.5f, Dynamics::computeGainReductionDb(compressor, -10));
+
+  DynamicsParameters expander{};
+  expander.fMode = EDynamicsMode::kExpander;
+  expander.fThresholdDb = -40;
+  expander.fRatio = 2;
+  expander.fKneeDb = 0;
+  expander.fRangeDb = 20;
+
+  ASSERT_EQ(0, Dynamics::computeGainReductionDb(expander, -10));
+  ASSERT_FLOAT_EQ(-10.0f, Dynamics::computeGainReductionDb(expander, -50));
+  ASSERT_FLOAT_EQ(-20.0f, Dynamics::computeGainReductionDb(expander, -100)); // range
+}
+
+// Steady state gains (peak detector, mono and stereo sidechain)
+TEST(Dynamics, Peak)
+{
+  Utils::SampleRateBasedClock clock{44100};
+  DynamicsParameters parameters{};
+  parameters.fThresholdDb = -20;
+  parameters.fRatio = 4;
+  parameters.fKneeDb = 0;
+  parameters.fAttackMs = 1;
+  parameters.fMakeupDb = 2;
+
+  Dynamics mono{clock, parameters};
+  Dynamics stereo{clock, parameters};
+
+  // -6.02dB => 14dB above the threshold => -10.5dB
+  AudioBuffer sidechain{};
+  StereoAudioBuffer stereoSidechain{};
+  std::fill(std::begin(sidechain.fAudioBuffer), std::end(sidechain.fAudioBuffer), -0.5f);
+  stereoSidechain.clear();
+  std::fill(std::begin(stereoSidechain.fRightAudioBuffer.fAudioBuffer),
+            std::end(stereoSidechain.fRightAudioBuffer.fAudioBuffer), 0.5f);
+
+  TJBox_Float32 gains[kBatchSize];
+  TJBox_Float32 stereoGains[kBatchSize];
+  for(int b = 0; b < 100; b++)
+  {
+    mono.process(sidechain, gains);
+    stereo.process(stereoSidechain, stereoGains);
+  }
+
+  auto const expectedDb = -(20 * std::log10(0.5f) + 20) * 0.75f + 2;
+  for(int i = 0; i < kBatchSize; i++)
+  {
+    ASSERT_NEAR(expectedDb, toDb(gains[i]), 1e-3f);
+    ASSERT_NEAR(expectedDb, toDb(stereoGains[i]), 1e-3f);
+  }
+  ASSERT_NEAR(expectedDb - 2, mono.getGainReductionDb(), 1e-3f);
+
+  // silence => release back to no reduction (only the makeup gain)
+  sidechain.clear();
+  for(int b = 0; b < 1000; b++)
+    mono.process(sidechain, gains);
+  ASSERT_NEAR(2.0f, toDb(gains[kBatchSize - 1]), 1e-3f);
+
+  mono.reset();
+  ASSERT_EQ(0, mono.getGainReductionDb());
+}
+
+// The attack time does not depend on the sample rate
+TEST(Dynamics, Attack)
+{
+  for(auto sampleRate: {44100, 48000, 96000})
+  {
+    Utils::SampleRateBasedClock clock{sampleRate};
+    DynamicsParameters parameters{};
+    parameters.fThresholdDb = -20;
+    parameters.fRatio = 4;
+    parameters.fKneeDb = 0;
+    parameters.fAttackMs = 10;
+
+    Dynamics dynamics{clock, parameters};
+
+    // 0dB => -15dB of gain reduction reached after 10ms at 1 - 1/e
+    AudioBuffer sidechain{};
+    std::fill(std::begin(sidechain.fAudioBuffer), std::end(sidechain.fAudioBuffer), 1.0f);
+    TJBox_Float32 gains[kBatchSize];
+    auto const samples = static_cast<int>(clock.getSampleCountFor(10));
+    int count = 0;
+    while(count + kBatchSize < samples)
+    {
+      dynamics.process(sidechain, gains);
+      count += kBatchSize;
+    }
+    dynamics.process(sidechain, gains);
+    auto const index = samples - count - 1;
+    ASSERT_NEAR(-15.0 * (1 - std::exp(-1.0)), toDb(gains[index]), 0.01) << sampleRate;
+  }
+}
+
+// RMS detector (stereo sidechain)
+TEST(Dynamics, Rms)
+{
+  Utils::SampleRateBasedClock clock{48000};
+  DynamicsParameters parameters{};
+  parameters.fDetector = EDynamicsDetector::kRms;
+  parameters.fThresholdDb = -20;
+  parameters.fRatio = 2;
+  parameters.fKneeDb = 0;
+  parameters.fAttackMs = 5;
+  parameters.fReleaseMs = 5;
+  parameters.fRmsWindowMs = 50;
+
+  Dynamics dynamics{clock, parameters};
+
+  // full scale sine => -3.01dB RMS => 16.99dB above the threshold => -8.49dB
+  StereoAudioBuffer sidechain{};
+  TJBox_Float32 gains[kBatchSize];
+  for(int b = 0; b < 1000; b++)
+  {
+    for(int i = 0; i < kBatchSize; i++)
+    {
+      auto const s = static_cast<TJBox_AudioSample>(std::sin(2.0 * kPi * 1000 * (b * kBatchSize + i) / 48000));
+      sidechain.fLeftAudioBuffer.fAudioBuffer[i] = s;
+      sidechain.fRightAudioBuffer.fAudioBuffer[i] = s;
+    }
+    dynamics.process(sidechain, gains);
+  }
+
+  for(int i = 0; i < kBatchSize; i++)
+    ASSERT_NEAR(-8.495f, toDb(gains[i]), 0.05f);
+}
+
+// Gate: closes on silence (down to the range)
+TEST(Dynamics, Gate)
+{
+  Utils::SampleRateBasedClock clock{44100};
+  DynamicsParameters parameters{};
+  parameters.fMode = EDynamicsMode::kExpander;
+  parameters.fThresholdDb = -50;
+  parameters.fRatio = 100;
+  parameters.fKneeDb = 0;
+  parameters.fRangeDb = 60;
+  parameters.fAttackMs = 1;
+  parameters.fReleaseMs = 1;
+
+  Dynamics gate{clock, parameters};
+  AudioBuffer sidechain{};
+  sidechain.clear();
+  TJBox_Float32 gains[kBatchSize];
+  for(int b = 0; b < 100; b++)
+    gate.process(sidechain, gains);
+  ASSERT_NEAR(-60.0f, toDb(gains[kBatchSize - 1]), 1e-3f);
+
+  // open
+  std::fill(std::begin(sidechain.fAudioBuffer), std::end(sidechain.fAudioBuffer), 0.1f);
+  for(int b = 0; b < 100; b++)
+    gate.process(sidechain, gains);
+  ASSERT_NEAR(0.0f, toDb(gains[kBatchSize - 1]), 1e-3f);
+}
+
+}
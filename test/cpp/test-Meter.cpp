@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <Meter.h>
+#include <gtest/gtest.h>
+
+namespace pongasoft::common::Test {
+
+namespace test_Meter {
+
+AudioBufferStats stats(TJBox_AudioSample iPeak)
+{
+  // constant signal at iPeak
+  return AudioBufferStats{iPeak, iPeak * kBatchSize, iPeak * iPeak * kBatchSize, kBatchSize};
+}
+
+// records the values stored (instead of a JBoxProperty)
+struct FakeProperty
+{
+  bool storeValueToMotherboardOnUpdate(TJBox_Float32 iValue)
+  {
+    if(fValue == iValue)
+      return false;
+    fValue = iValue;
+    fWriteCount++;
+    return true;
+  }
+
+  TJBox_Float32 fValue{};
+  int fWriteCount{};
+};
+
+}
+
+using namespace test_Meter;
+
+// Meter
+TEST(Meter, Ballistics)
+{
+  Utils::SampleRateBasedClock clock{44100};
+  MeterBallistics ballistics{};
+  ballistics.fAttackMs = 0;
+  ballistics.fReleaseMs = 100;
+  ballistics.fPeakHoldMs = 50;
+  ballistics.fRmsWindowMs = 300;
+
+  Meter meter{clock, ballistics};
+
+  // instant attack
+  meter.process(stats(0.5f));
+  ASSERT_EQ(0.5f, meter.getPeak());
+  ASSERT_EQ(0.5f, meter.getPeakHold());
+  ASSERT_NEAR(-6.02f, meter.getPeakDb(), 1e-3f);
+  ASSERT_EQ(0, meter.getClipCount());
+
+  // release: after 100ms, the level is divided by e
+  auto const batchesIn100ms = clock.getSampleCountFor(100) / kBatchSize;
+  for(TJBox_UInt32 i = 0; i < batchesIn100ms; i++)
+  {
+    meter.process(stats(0));
+    if(i * kBatchSize < clock.getSampleCountFor(50) - kBatchSize)
+    {
+      ASSERT_EQ(0.5f, meter.getPeakHold()) << i;
+    }
+  }
+  ASSERT_NEAR(0.5f / std::exp(1.0f), meter.getPeak(), 0.01f);
+
+  // peak hold has expired => follows the level
+  ASSERT_EQ(meter.getPeak(), meter.getPeakHold());
+
+  // rms converges to the rms of the signal
+  meter.reset();
+  ASSERT_EQ(Meter::kMinDb, meter.getPeakDb());
+  ASSERT_EQ(Meter::kMinDb, meter.getRmsDb());
+  for(int i = 0; i < 5000; i++) // ~7s (>> 300ms)
+    meter.process(stats(0.25f));
+  ASSERT_NEAR(0.25f, meter.getRms(), 1e-4f);
+  ASSERT_NEAR(-12.04f, meter.getRmsDb(), 1e-2f);
+
+  // clips
+  meter.process(stats(1.0f));
+  meter.process(stats(1.5f));
+  meter.process(stats(0.5f));
+  ASSERT_EQ(2, meter.getClipCount());
+  meter.resetClipCount();
+  ASSERT_EQ(0, meter.getClipCount());
+}
+
+// MeterPublisher
+TEST(Meter, MeterPublisher)
+{
+  Utils::SampleRateBasedClock clock{44100};
+  Meter meter{clock, MeterBallistics{}};
+  MeterPublisher publisher{clock.getRateLimiter(40)};
+  FakeProperty property{};
+
+  // 1s of constant signal: published ~25 times but only written once (value does not change)
+  int publishCount = 0;
+  for(int i = 0; i < 44100 / kBatchSize; i++)
+  {
+    meter.process(stats(0.5f));
+    if(publisher.shouldPublish(kBatchSize))
+    {
+      publishCount++;
+      MeterPublisher::publish(property, meter.getPeakDb(), 0.1f);
+    }
+  }
+  ASSERT_EQ(24, publishCount);
+  ASSERT_EQ(1, property.fWriteCount);
+  ASSERT_NEAR(-6.0f, property.fValue, 1e-5f);
+}
+
+}
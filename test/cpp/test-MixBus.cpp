@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <MixBus.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+
+namespace pongasoft::common::Test {
+
+// mix of several sources
+TEST(MixBus, Mix)
+{
+  StereoAudioBuffer in1{};
+  StereoAudioBuffer in2{};
+  StereoAudioBuffer in3{};
+  StereoAudioBuffer out{};
+
+  std::fill(std::begin(in1.fLeftAudioBuffer.fAudioBuffer), std::end(in1.fLeftAudioBuffer.fAudioBuffer), 0.5f);
+  std::fill(std::begin(in1.fRightAudioBuffer.fAudioBuffer), std::end(in1.fRightAudioBuffer.fAudioBuffer), -0.5f);
+  std::fill(std::begin(in2.fLeftAudioBuffer.fAudioBuffer), std::end(in2.fLeftAudioBuffer.fAudioBuffer), 0.25f);
+  std::fill(std::begin(in2.fRightAudioBuffer.fAudioBuffer), std::end(in2.fRightAudioBuffer.fAudioBuffer), 0.25f);
+  std::fill(std::begin(in3.fLeftAudioBuffer.fAudioBuffer), std::end(in3.fLeftAudioBuffer.fAudioBuffer), 1.0f);
+  std::fill(std::begin(in3.fRightAudioBuffer.fAudioBuffer), std::end(in3.fRightAudioBuffer.fAudioBuffer), 1.0f);
+
+  StereoMixBus bus{};
+
+  // no source => silence
+  std::fill(std::begin(out.fLeftAudioBuffer.fAudioBuffer), std::end(out.fLeftAudioBuffer.fAudioBuffer), 3.0f);
+  bus.mix(out);
+  ASSERT_TRUE(out.isSilent());
+
+  ASSERT_TRUE(bus.addSource(in1, 2.0f));
+  ASSERT_TRUE(bus.addSource(in2, 1.0f));
+  ASSERT_FALSE(bus.addSource(in3, 1.0f, false)); // disabled (ex: disconnected)
+  ASSERT_FALSE(bus.addSource(in3, 0)); // no contribution
+  ASSERT_EQ(2, bus.getSourceCount());
+
+  bus.mix(out);
+  for(int i = 0; i < kBatchSize; i++)
+  {
+    ASSERT_EQ(1.25f, out.fLeftAudioBuffer.fAudioBuffer[i]);
+    ASSERT_EQ(-0.75f, out.fRightAudioBuffer.fAudioBuffer[i]);
+  }
+
+  bus.reset();
+  ASSERT_EQ(0, bus.getSourceCount());
+}
+
+// sources beyond maxSources are dropped (no write past the end of the arrays)
+TEST(MixBus, TooManySources)
+{
+  StereoAudioBuffer in{};
+  std::fill(std::begin(in.fLeftAudioBuffer.fAudioBuffer), std::end(in.fLeftAudioBuffer.fAudioBuffer), 1.0f);
+  std::fill(std::begin(in.fRightAudioBuffer.fAudioBuffer), std::end(in.fRightAudioBuffer.fAudioBuffer), 2.0f);
+
+  TStereoMixBus<kBatchSize, 4> bus{};
+  for(int i = 0; i < 4; i++)
+    ASSERT_TRUE(bus.addSource(in, 1.0f));
+  ASSERT_FALSE(bus.addSource(in, 1.0f));
+  ASSERT_FALSE(bus.addSource(in, 1.0f));
+  ASSERT_EQ(4, bus.getSourceCount());
+
+  StereoAudioBuffer out{};
+  bus.mix(out);
+  for(int i = 0; i < kBatchSize; i++)
+  {
+    ASSERT_EQ(4.0f, out.fLeftAudioBuffer.fAudioBuffer[i]);
+    ASSERT_EQ(8.0f, out.fRightAudioBuffer.fAudioBuffer[i]);
+  }
+
+  // room again after reset
+  bus.reset();
+  ASSERT_TRUE(bus.addSource(in, 1.0f));
+  ASSERT_EQ(1, bus.getSourceCount());
+}
+
+}
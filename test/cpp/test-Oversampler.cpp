@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <Oversampler.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+namespace pongasoft::common::Test {
+
+namespace test_Oversampler {
+
+auto identity = [](TJBox_AudioSample *, int) {};
+
+// runs the input through the oversampler (batch by batch)
+template<int factor, typename Kernel>
+std::vector<TJBox_AudioSample> oversample(std::vector<TJBox_AudioSample> iInput, Kernel &&iKernel)
+{
+  TOversampler<factor> oversampler{};
+  for(size_t offset = 0; offset + kBatchSize <= iInput.size(); offset += kBatchSize)
+    oversampler.process(iInput.data() + offset, iKernel);
+  return iInput;
+}
+
+std::vector<TJBox_AudioSample> sine(TJBox_Float64 iFrequency, int iSampleRate, int iCount)
+{
+  std::vector<TJBox_AudioSample> res(iCount);
+  for(int i = 0; i < iCount; i++)
+    res[i] = static_cast<TJBox_AudioSample>(std::sin(2.0 * kPi * iFrequency * i / iSampleRate));
+  return res;
+}
+
+// amplitude of the frequency in the last iCount samples (Goertzel)
+TJBox_Float64 amplitude(std::vector<TJBox_AudioSample> const &iSamples, TJBox_Float64 iFrequency, int iSampleRate,
+                        int iCount)
+{
+  auto const w = 2.0 * kPi * iFrequency / iSampleRate;
+  auto const coeff = 2.0 * std::cos(w);
+  TJBox_Float64 s1 = 0, s2 = 0;
+  for(size_t i = iSamples.size() - iCount; i < iSamples.size(); i++)
+  {
+    auto const s = iSamples[i] + coeff * s1 - s2;
+    s2 = s1;
+    s1 = s;
+  }
+  return 2.0 * std::sqrt(s1 * s1 + s2 * s2 - coeff * s1 * s2) / iCount;
+}
+
+}
+
+using namespace test_Oversampler;
+
+// The impulse response is symmetric around the reported latency (linear phase) with a unity gain
+TEST(Oversampler, Latency)
+{
+  ASSERT_EQ(23, Oversampler2x::kLatency);
+  ASSERT_EQ(28.5f, Oversampler4x::kLatency);
+
+  std::vector<TJBox_AudioSample> impulse(4 * kBatchSize, 0);
+  impulse[0] = 1.0f;
+
+  auto const res2x = oversample<2>(impulse, identity);
+  ASSERT_EQ(23, std::max_element(res2x.begin(), res2x.end()) - res2x.begin());
+  TJBox_Float64 sum = 0;
+  for(auto s: res2x)
+    sum += s;
+  ASSERT_NEAR(1.0, sum, 1e-5);
+  for(int k = 1; k <= 23; k++)
+    ASSERT_NEAR(res2x[23 - k], res2x[23 + k], 1e-6) << k;
+  for(int i = 47; i < 4 * kBatchSize; i++)
+    ASSERT_EQ(0, res2x[i]) << i;
+
+  auto const res4x = oversample<4>(impulse, identity);
+  sum = 0;
+  for(auto s: res4x)
+    sum += s;
+  ASSERT_NEAR(1.0, sum, 1e-5);
+  for(int k = 0; k <= 28; k++)
+    ASSERT_NEAR(res4x[28 - k], res4x[29 + k], 1e-6) << k;
+}
+
+// Frequencies in the pass band go through unchanged (delayed by the latency)
+TEST(Oversampler, PassBand)
+{
+  constexpr int sampleRate = 48000;
+  constexpr int count = 100 * kBatchSize;
+
+  for(auto frequency: {100.0, 1000.0, 10000.0, 16000.0})
+  {
+    auto const input = sine(frequency, sampleRate, count);
+    auto const res2x = oversample<2>(input, identity);
+    auto const res4x = oversample<4>(input, identity);
+    for(int i = kBatchSize; i < count; i++)
+    {
+      ASSERT_NEAR(std::sin(2.0 * kPi * frequency * (i - Oversampler2x::kLatency) / sampleRate), res2x[i], 1e-3);
+      ASSERT_NEAR(std::sin(2.0 * kPi * frequency * (i - Oversampler4x::kLatency) / sampleRate), res4x[i], 1e-3);
+    }
+  }
+}
+
+// Saturating a high frequency aliases a lot less
+TEST(Oversampler, Aliasing)
+{
+  constexpr int sampleRate = 48000;
+  constexpr int count = 100 * kBatchSize;
+
+  // 3rd harmonic of 15kHz (45kHz) aliases to 3kHz
+  auto const input = sine(15000, sampleRate, count);
+  auto const clip = [](TJBox_AudioSample *ioSamples, int iCount) { dsp::softClip(ioSamples, 3.0f, 1.0f, iCount); };
+
+  auto direct = input;
+  clip(direct.data(), count);
+  auto const res2x = oversample<2>(input, clip);
+  auto const res4x = oversample<4>(input, clip);
+
+  auto const window = 4800; // integer number of periods of both 15kHz and 3kHz
+  auto const alias = amplitude(direct, 3000, sampleRate, window);
+  auto const alias2x = amplitude(res2x, 3000, sampleRate, window);
+  auto const alias4x = amplitude(res4x, 3000, sampleRate, window);
+  ASSERT_GT(alias, 0.1); // -20dB
+  ASSERT_LT(alias2x, alias / 100); // 40dB less
+  ASSERT_LT(alias4x, alias / 100);
+
+  // same fundamental
+  ASSERT_NEAR(amplitude(direct, 15000, sampleRate, window), amplitude(res2x, 15000, sampleRate, window), 1e-2);
+  ASSERT_NEAR(amplitude(direct, 15000, sampleRate, window), amplitude(res4x, 15000, sampleRate, window), 1e-2);
+}
+
+}
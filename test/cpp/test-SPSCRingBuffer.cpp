@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <SPSCRingBuffer.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace pongasoft::common::Test {
+
+// push/pop (single thread)
+TEST(SPSCRingBuffer, PushPop)
+{
+  TSPSCRingBuffer<int, 8> ring{};
+  ASSERT_EQ(8, ring.getCapacity());
+  ASSERT_EQ(0, ring.getReadAvailable());
+  ASSERT_EQ(8, ring.getWriteAvailable());
+
+  int value = -1;
+  ASSERT_FALSE(ring.pop(value));
+  ASSERT_EQ(-1, value);
+
+  // wraps around many times (including the uint32_t indexes)
+  int next = 0;
+  int expected = 0;
+  for(int i = 0; i < 1000; i++)
+  {
+    int src[5];
+    for(auto &v: src)
+      v = next++;
+    auto const pushed = ring.push(src, 5);
+    next -= 5 - pushed;
+    ASSERT_EQ(std::min(5, 8 - (next - pushed - expected)), pushed) << i;
+
+    int dst[3];
+    auto const popped = ring.pop(dst, 3);
+    for(int k = 0; k < popped; k++)
+      ASSERT_EQ(expected++, dst[k]) << i;
+    ASSERT_EQ(next - expected, ring.getReadAvailable());
+    ASSERT_EQ(8 - (next - expected), ring.getWriteAvailable());
+  }
+
+  // full
+  while(ring.push(next))
+    next++;
+  ASSERT_EQ(8, ring.getReadAvailable());
+  ASSERT_EQ(0, ring.getWriteAvailable());
+  ASSERT_EQ(0, ring.push(&next, 1));
+
+  // empty
+  while(ring.pop(value))
+    ASSERT_EQ(expected++, value);
+  ASSERT_EQ(next, expected);
+
+  // batches (all or nothing)
+  TSPSCRingBuffer<TJBox_AudioSample, 2 * kBatchSize> audio{};
+  AudioBuffer buffer{};
+  for(int i = 0; i < kBatchSize; i++)
+    buffer.fAudioBuffer[i] = static_cast<TJBox_AudioSample>(i);
+  ASSERT_TRUE(audio.push(buffer));
+  TJBox_AudioSample sample = 0;
+  ASSERT_TRUE(audio.pop(sample));
+  ASSERT_TRUE(audio.push(buffer));
+  ASSERT_FALSE(audio.push(buffer));
+
+  AudioBuffer out{};
+  ASSERT_TRUE(audio.pop(out));
+  for(int i = 0; i < kBatchSize - 1; i++)
+    ASSERT_EQ(i + 1, out.fAudioBuffer[i]);
+  ASSERT_EQ(0, out.fAudioBuffer[kBatchSize - 1]);
+  ASSERT_FALSE(audio.pop(out));
+  ASSERT_EQ(kBatchSize - 1, audio.getReadAvailable());
+}
+
+// 1 producer and 1 consumer thread: every element is received, in order
+TEST(SPSCRingBuffer, Threads)
+{
+  constexpr int kCount = 200000;
+  auto ring = std::make_unique<TSPSCRingBuffer<int, 1024>>();
+
+  std::thread producer{[&ring] {
+    std::mt19937 generator{1};
+    std::uniform_int_distribution<int> counts{1, 100};
+    std::vector<int> block(100);
+    int next = 0;
+    while(next < kCount)
+    {
+      auto const count = std::min(counts(generator), kCount - next);
+      for(int i = 0; i < count; i++)
+        block[i] = next + i;
+      auto const pushed = ring->push(block.data(), count);
+      if(pushed == 0)
+        std::this_thread::yield();
+      next += pushed;
+    }
+  }};
+
+  std::mt19937 generator{2};
+  std::uniform_int_distribution<int> counts{1, 100};
+  std::vector<int> block(100);
+  int expected = 0;
+  bool inOrder = true;
+  while(expected < kCount)
+  {
+    auto const count = ring->pop(block.data(), counts(generator));
+    if(count == 0)
+      std::this_thread::yield();
+    for(int i = 0; i < count; i++)
+      inOrder &= block[i] == expected++;
+  }
+
+  producer.join();
+  ASSERT_TRUE(inOrder);
+  ASSERT_EQ(kCount, expected);
+  ASSERT_EQ(0, ring->getReadAvailable());
+}
+
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <SlidingWindow.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <deque>
+#include <random>
+
+namespace pongasoft::common::Test {
+
+namespace test_SlidingWindow {
+
+// compares the window with the aggregates computed from scratch after every value pushed
+template<typename T, typename Distribution>
+void testSlidingWindow(int iSize, Distribution iDistribution, int iCount, double iTolerance)
+{
+  SlidingWindow<T> window{iSize};
+  std::deque<T> expected{};
+  std::mt19937 generator{static_cast<unsigned int>(iSize)};
+
+  for(int i = 0; i < iCount; i++)
+  {
+    auto const value = static_cast<T>(iDistribution(generator));
+    window.push(value);
+    expected.push_back(value);
+    if(static_cast<int>(expected.size()) > iSize)
+      expected.pop_front();
+
+    ASSERT_EQ(static_cast<int>(expected.size()), window.getCount()) << i;
+    ASSERT_EQ(*std::min_element(expected.begin(), expected.end()), window.getMin()) << i;
+    ASSERT_EQ(*std::max_element(expected.begin(), expected.end()), window.getMax()) << i;
+    ASSERT_EQ(value, window.getHistory().getAt(-1)) << i;
+
+    double sum = 0;
+    for(auto v: expected)
+      sum += v;
+    ASSERT_NEAR(sum, window.getSum(), iTolerance) << i;
+    ASSERT_NEAR(static_cast<T>(sum) / static_cast<T>(expected.size()), window.getMean(), iTolerance) << i;
+  }
+}
+
+}
+
+using namespace test_SlidingWindow;
+
+TEST(SlidingWindow, Aggregates)
+{
+  SlidingWindow<int> empty{10};
+  ASSERT_EQ(0, empty.getCount());
+  ASSERT_EQ(0, empty.getSum());
+  ASSERT_EQ(0, empty.getMean());
+  ASSERT_EQ(0, empty.getMin());
+  ASSERT_EQ(0, empty.getMax());
+
+  for(int size: {1, 2, 3, 10, 64, 100})
+  {
+    // small range of ints => lots of duplicates
+    testSlidingWindow<int>(size, std::uniform_int_distribution<int>{-5, 5}, 1000, 0);
+    testSlidingWindow<float>(size, std::uniform_real_distribution<float>{-1.0f, 1.0f}, 1000, 1e-5);
+  }
+
+  // monotonic sequences (worst cases for the deques)
+  SlidingWindow<int> window{5};
+  for(int i = 0; i < 20; i++)
+  {
+    window.push(i);
+    ASSERT_EQ(std::max(0, i - 4), window.getMin());
+    ASSERT_EQ(i, window.getMax());
+  }
+  for(int i = 14; i >= 0; i--)
+  {
+    window.push(i);
+    ASSERT_EQ(i, window.getMin());
+  }
+  ASSERT_EQ(4, window.getMax());
+
+  window.reset();
+  ASSERT_EQ(0, window.getCount());
+  window.push(-3);
+  ASSERT_EQ(-3, window.getMax());
+  ASSERT_EQ(-3, window.getSum());
+}
+
+// the running sum does not drift (recomputed from the history)
+TEST(SlidingWindow, Drift)
+{
+  constexpr int kSize = 10000;
+  SlidingWindow<TJBox_Float32> window{kSize};
+  std::mt19937 generator{1};
+  std::uniform_real_distribution<TJBox_Float32> distribution{0.0f, 1000.0f};
+  for(int i = 0; i < 100 * kSize + 17; i++)
+    window.push(distribution(generator));
+
+  double sum = 0;
+  for(int i = 0; i < kSize; i++)
+    sum += window.getHistory().getAt(i);
+  ASSERT_NEAR(1.0, window.getSum() / sum, 1e-5);
+
+  // buffers (the sum is exactly 0 once recomputed from a window of zeros)
+  AudioBuffer buffer{};
+  buffer.clear();
+  for(int i = 0; i < 2 * kSize / kBatchSize + 1; i++)
+    window.push(buffer);
+  ASSERT_EQ(0, window.getMax());
+  ASSERT_EQ(0, window.getSum());
+}
+
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <Smoother.h>
+#include <Volume.h>
+#include <gtest/gtest.h>
+#include <cmath>
+
+namespace pongasoft::common::Test {
+
+// Default behavior (1/100 per batch) is the same as the previous VolumeState implementation
+TEST(Smoother, Legacy)
+{
+  TJBox_Float32 expected = 1.0f;
+  VolumeState volume{1.0f, true};
+
+  for(int i = 0; i < 1000; i++)
+  {
+    auto const target = i < 500 ? 0.2f : 0.8f;
+
+    // previous implementation
+    if(std::abs(expected - target) < 0.01f)
+      expected = target;
+    else
+      expected += (target - expected) / 100.0f;
+
+    volume.adjustVolume(target);
+    ASSERT_NEAR(expected, volume.getVolume(), 1e-5f) << i;
+  }
+
+  // no per sample table (VolumeState is used per channel/parameter)
+  ASSERT_LE(sizeof(VolumeState), 6 * sizeof(TJBox_Float32));
+
+  VolumeState noFilter{1.0f, false};
+  ASSERT_TRUE(noFilter.adjustVolume(0.5f));
+  ASSERT_EQ(0.5f, noFilter.getVolume());
+  ASSERT_FALSE(noFilter.adjustVolume(0.5f));
+}
+
+// The response time does not depend on the sample rate anymore
+TEST(Smoother, TimeConstant)
+{
+  for(auto sampleRate: {44100, 48000, 96000, 192000})
+  {
+    Utils::SampleRateBasedClock clock{sampleRate};
+    OnePoleSmoother smoother{0, 1e-6f};
+    smoother.setTimeConstant(clock, 50);
+    smoother.setTargetValue(1.0f);
+
+    // after 50ms => 1 - 1/e
+    auto const batches = clock.getSampleCountFor(50) / kBatchSize;
+    for(TJBox_UInt32 i = 0; i < batches; i++)
+      ASSERT_TRUE(smoother.nextBatch());
+    auto const elapsedMs = batches * kBatchSize * 1000.0 / sampleRate;
+    ASSERT_NEAR(1.0 - std::exp(-elapsedMs / 50.0), smoother.getValue(), 1e-4) << sampleRate;
+  }
+
+  // 0 = no smoothing
+  Utils::SampleRateBasedClock clock{44100};
+  OnePoleSmoother smoother{0};
+  smoother.setTimeConstant(clock, 0);
+  smoother.setTargetValue(1.0f);
+  smoother.nextBatch();
+  ASSERT_EQ(1.0f, smoother.getValue());
+  ASSERT_TRUE(smoother.isSettled());
+}
+
+// per sample values
+TEST(Smoother, PerSample)
+{
+  Utils::SampleRateBasedClock clock{44100};
+  OnePoleSmoother smoother{0.5f, 1e-3f};
+  OnePoleSmoother reference{0.5f, 1e-3f};
+  smoother.setTimeConstant(clock, 10);
+  reference.setTimeConstant(clock, 10);
+  smoother.setTargetValue(1.0f);
+  reference.setTargetValue(1.0f);
+
+  // y[n] = y[n-1] + (1 - r) * (target - y[n-1])
+  auto const r = std::exp(-1.0 / (10 * 44.1));
+  TJBox_Float64 expected = 0.5;
+
+  TJBox_Float32 values[kBatchSize];
+  int batchCount = 0;
+  while(smoother.nextBatch(values))
+  {
+    reference.nextBatch();
+    ASSERT_EQ(reference.getValue(), smoother.getValue());
+    if(!smoother.isSettled())
+    {
+      ASSERT_EQ(values[kBatchSize - 1], smoother.getValue());
+      for(int i = 0; i < kBatchSize; i++)
+      {
+        expected = 1.0 + (expected - 1.0) * r;
+        ASSERT_NEAR(expected, values[i], 1e-5);
+      }
+    }
+    batchCount++;
+  }
+  ASSERT_TRUE(smoother.isSettled());
+  ASSERT_EQ(1.0f, smoother.getValue());
+  ASSERT_GT(batchCount, 10);
+
+  // settled => constant
+  ASSERT_FALSE(smoother.nextBatch(values));
+  for(auto v: values)
+    ASSERT_EQ(1.0f, v);
+}
+
+}
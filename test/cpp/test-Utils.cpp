@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <Utils.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+
+namespace pongasoft::common::Test {
+
+// FilteredValue moves 1/100 of the remaining distance per call (in the arithmetic of T)
+TEST(Utils, FilteredValue)
+{
+  Utils::FilteredValue<int> value{0, true};
+  int expected = 0;
+  for(int i = 0; i < 2000; i++)
+  {
+    auto const changed = value.adjustValue(10000);
+    auto const previous = expected;
+    expected += (10000 - expected) / 100;
+    ASSERT_EQ(expected, value.getValue()) << i;
+    ASSERT_EQ(previous != expected, changed) << i;
+  }
+  // integer division: stops 99 short of the target
+  ASSERT_EQ(9901, value.getValue());
+  ASSERT_FALSE(value.adjustValue(10000));
+
+  // filter off => jumps to the target
+  value.setFilterOn(false);
+  ASSERT_TRUE(value.adjustValue(-3));
+  ASSERT_EQ(-3, value.getValue());
+
+  // update copies the value and the filter state
+  Utils::FilteredValue<int> other{100, true};
+  other.update(value);
+  ASSERT_EQ(-3, other.getValue());
+  ASSERT_TRUE(other.adjustValue(1000));
+  ASSERT_EQ(1000, other.getValue());
+
+  // no precision loss above 2^24
+  constexpr int64_t kBig = (static_cast<int64_t>(1) << 40) + 1;
+  Utils::FilteredValue<int64_t> big{kBig, true};
+  ASSERT_EQ(kBig, big.getValue());
+  ASSERT_TRUE(big.adjustValue(kBig + 10001));
+  ASSERT_EQ(kBig + 100, big.getValue());
+}
+
+}
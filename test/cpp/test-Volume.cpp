@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <Volume.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+namespace pongasoft::common::Test {
+
+// fastCbrt
+TEST(Volume, fastCbrt)
+{
+  ASSERT_EQ(0, VolumeImpl::fastCbrt(0));
+  ASSERT_EQ(0, VolumeImpl::fastCbrt(-1.0f));
+
+  TJBox_Float64 maxError = 0;
+  for(TJBox_Float64 x = 1e-30; x < 1e30; x *= 1.001)
+  {
+    auto const value = static_cast<TJBox_Float32>(x);
+    auto const expected = std::cbrt(static_cast<TJBox_Float64>(value));
+    maxError = std::max(maxError, std::fabs(VolumeImpl::fastCbrt(value) / expected - 1.0));
+  }
+  ASSERT_LT(maxError, 4e-7);
+}
+
+// toVolumeCube / fromVolumeCube
+TEST(Volume, VolumeCube)
+{
+  ASSERT_EQ(Volume_Init_Value, toVolumeCube(0.7f));
+  ASSERT_EQ(0, toVolumeCube(0.0f));
+  ASSERT_EQ(0.7f, fromVolumeCubeToFloat(Volume_Init_Value));
+  ASSERT_EQ(0, fromVolumeCubeToFloat(0));
+
+  std::vector<TJBox_Float32> volumes{};
+  for(int i = 0; i <= 1000; i++)
+    volumes.emplace_back(static_cast<TJBox_Float32>(i) / 1000);
+
+  std::vector<TJBox_Float32> gains(volumes.size());
+  toVolumeCube(volumes.data(), gains.data(), static_cast<int>(volumes.size()));
+
+  std::vector<TJBox_Float32> roundTrip(volumes.size());
+  fromVolumeCube(gains.data(), roundTrip.data(), static_cast<int>(volumes.size()));
+
+  for(size_t i = 0; i < volumes.size(); i++)
+  {
+    auto const volume = volumes[i];
+
+    // buffer version is identical to the single value version
+    ASSERT_EQ(toVolumeCube(volume), gains[i]);
+    ASSERT_EQ(fromVolumeCubeToFloat(gains[i]), roundTrip[i]);
+
+    // compare to the "exact" (double precision) formulas
+    ASSERT_NEAR(std::pow(volume / 0.7, 3.0), gains[i], 2e-6);
+    ASSERT_NEAR(std::pow(static_cast<TJBox_Float64>(gains[i]), 1.0 / 3) * 0.7, roundTrip[i], 1e-6);
+    ASSERT_NEAR(volume, roundTrip[i], 1e-6);
+  }
+
+  // both versions agree around unity (every float within 2e-5 of 0.7)
+  std::vector<TJBox_Float32> nearUnity{};
+  for(auto v = 0.7f - 2e-5f; v < 0.7f + 2e-5f; v = std::nextafter(v, 1.0f))
+    nearUnity.emplace_back(v);
+  std::vector<TJBox_Float32> nearUnityGains(nearUnity.size());
+  toVolumeCube(nearUnity.data(), nearUnityGains.data(), static_cast<int>(nearUnity.size()));
+  for(size_t i = 0; i < nearUnity.size(); i++)
+    ASSERT_EQ(toVolumeCube(nearUnity[i]), nearUnityGains[i]) << nearUnity[i];
+
+  // negative gains (invalid) are mapped to 0
+  ASSERT_EQ(0, fromVolumeCubeToFloat(-1.0f));
+}
+
+}